@@ -0,0 +1,205 @@
+/// \file BitGrid.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "BitGrid.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+
+namespace gol {
+
+///
+BitGrid::BitGrid(int width, int height)
+    : m_width(width)
+    , m_height(height)
+    , m_wordsPerRow(width / BITS_PER_WORD + 1)
+    , m_stride(m_wordsPerRow + 2)
+    , m_lastWordMask(
+              (width % BITS_PER_WORD) == 0 ? 0 : (BitWord{1} << (width % BITS_PER_WORD)) - 1)
+    , m_words(static_cast<std::size_t>(height + 2) * m_stride, 0) {}
+
+/// \note Compares cell contents only; halo and padding bits are ignored
+bool BitGrid::operator==(const BitGrid& rhs) const {
+    if (m_width != rhs.m_width || m_height != rhs.m_height) {
+        return false;
+    }
+
+    for (auto row = 0; row < m_height; ++row) {
+        const auto* lhsRow = rowWords(row);
+        const auto* rhsRow = rhs.rowWords(row);
+        if (!std::equal(lhsRow, lhsRow + m_wordsPerRow - 1, rhsRow)) {
+            return false;
+        }
+
+        if (((lhsRow[m_wordsPerRow - 1] ^ rhsRow[m_wordsPerRow - 1]) & m_lastWordMask) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// \note ORs \p source into this grid with its top left corner at (colOffset, rowOffset);
+/// the source must fit entirely within this grid
+void BitGrid::blit(const BitGrid& source, int colOffset, int rowOffset) {
+    const auto wordOffset = colOffset / BITS_PER_WORD;
+    const auto bitOffset = colOffset % BITS_PER_WORD;
+    const auto sourceWords = source.getWordsPerRow();
+
+    for (auto row = 0; row < source.getHeight(); ++row) {
+        const auto* from = source.rowWords(row);
+        auto* to = rowWords(row + rowOffset) + wordOffset;
+        for (auto i = 0; i < sourceWords; ++i) {
+            auto word = (i == sourceWords - 1) ? from[i] & source.getLastWordMask() : from[i];
+            to[i] |= word << bitOffset;
+            if (bitOffset != 0) {
+                to[i + 1] |= word >> (BITS_PER_WORD - bitOffset);
+            }
+        }
+    }
+}
+
+///
+void BitGrid::clear() {
+    std::fill(m_words.begin(), m_words.end(), 0);
+}
+
+/// \note Zeroes the guards and the east halo bit, restoring the bounded halo
+void BitGrid::clearHalo() {
+    std::fill_n(rowWords(-1) - 1, m_stride, 0);
+    std::fill_n(rowWords(m_height) - 1, m_stride, 0);
+
+    const auto eastWord = m_width / BITS_PER_WORD;
+    const auto eastBit = BitWord{1} << (m_width % BITS_PER_WORD);
+    for (auto row = 0; row < m_height; ++row) {
+        auto* words = rowWords(row);
+        words[-1] = 0;
+        words[eastWord] &= ~eastBit;
+    }
+}
+
+/// Copies into the halo the cells that lie beyond each edge under topology \p T
+/// \note A bounded grid keeps its guards clear, so only joined edges have work to do; a torus
+/// copies whole guard rows, while twisted edges are filled a cell at a time
+template<Topology T>
+void BitGrid::fillHalo() {
+    if constexpr (T == Topology::BOUNDED) {
+        return;
+    } else {
+        if (m_width == 0 || m_height == 0) {
+            return;
+        }
+
+        auto cellBeyond = [this](int col, int row) {
+            mapOntoGrid<T>(col, row, m_width, m_height);
+            return get(col, row);
+        };
+
+        const auto eastWord = m_width / BITS_PER_WORD;
+        const auto eastBit = BitWord{1} << (m_width % BITS_PER_WORD);
+        for (auto row = 0; row < m_height; ++row) {
+            auto* words = rowWords(row);
+            words[-1] = cellBeyond(-1, row) ? BitWord{1} << (BITS_PER_WORD - 1) : 0;
+            words[eastWord] =
+                    (words[eastWord] & ~eastBit) | (cellBeyond(m_width, row) ? eastBit : 0);
+        }
+
+        if constexpr (T == Topology::TORUS) {
+            std::memcpy(rowWords(-1) - 1, rowWords(m_height - 1) - 1, m_stride * sizeof(BitWord));
+            std::memcpy(rowWords(m_height) - 1, rowWords(0) - 1, m_stride * sizeof(BitWord));
+        } else {
+            for (auto row : {-1, m_height}) {
+                auto* words = rowWords(row);
+                std::fill_n(words - 1, m_stride, 0);
+                words[-1] = cellBeyond(-1, row) ? BitWord{1} << (BITS_PER_WORD - 1) : 0;
+                for (auto col = 0; col <= m_width; ++col) {
+                    if (cellBeyond(col, row)) {
+                        words[col / BITS_PER_WORD] |= BitWord{1} << (col % BITS_PER_WORD);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template void BitGrid::fillHalo<Topology::BOUNDED>();
+template void BitGrid::fillHalo<Topology::TORUS>();
+template void BitGrid::fillHalo<Topology::KLEIN_BOTTLE>();
+template void BitGrid::fillHalo<Topology::CROSS_SURFACE>();
+
+/// \note Picked once, so stepping never branches on the topology
+BitGrid::HaloFill BitGrid::haloFillFor(Topology topology) {
+    switch (topology) {
+    case Topology::TORUS:
+        return &BitGrid::fillHalo<Topology::TORUS>;
+    case Topology::KLEIN_BOTTLE:
+        return &BitGrid::fillHalo<Topology::KLEIN_BOTTLE>;
+    case Topology::CROSS_SURFACE:
+        return &BitGrid::fillHalo<Topology::CROSS_SURFACE>;
+    default:
+        return &BitGrid::fillHalo<Topology::BOUNDED>;
+    }
+}
+
+///
+void BitGrid::set(int col, int row, bool alive) {
+    auto& word = rowWords(row)[col / BITS_PER_WORD];
+    const auto bit = BitWord{1} << (col % BITS_PER_WORD);
+    word = alive ? (word | bit) : (word & ~bit);
+}
+
+///
+int BitGrid::getHeight() const {
+    return m_height;
+}
+
+///
+int BitGrid::getWidth() const {
+    return m_width;
+}
+
+///
+int BitGrid::getWordsPerRow() const {
+    return m_wordsPerRow;
+}
+
+/// \note Mask of the valid cells in the last data word of each row
+BitWord BitGrid::getLastWordMask() const {
+    return m_lastWordMask;
+}
+
+///
+std::size_t BitGrid::getPopulation() const {
+    std::size_t population = 0;
+    for (auto row = 0; row < m_height; ++row) {
+        const auto* words = rowWords(row);
+        for (auto i = 0; i < m_wordsPerRow - 1; ++i) {
+            population += std::popcount(words[i]);
+        }
+        population += std::popcount(words[m_wordsPerRow - 1] & m_lastWordMask);
+    }
+
+    return population;
+}
+}  // namespace gol
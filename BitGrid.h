@@ -0,0 +1,101 @@
+/// \file BitGrid.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "Topology.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gol {
+using BitWord = std::uint64_t;
+constexpr int BITS_PER_WORD{64};
+
+/// Bit-packed cell storage: one bit per cell, bit j of word k holding column 64k + j.
+/// \note Every row carries a guard word on either side, and the grid carries a guard row
+/// above and below; the guards hold the halo read by the generation kernel, so the kernel
+/// never has to test its bounds. Each row also reserves the bit for column `width`, which
+/// holds the east halo when the grid is wrapped.
+class BitGrid {
+public:
+    /// One of the fillHalo() instantiations, chosen once for a grid's topology
+    using HaloFill = void (BitGrid::*)();
+
+    BitGrid() = default;
+    BitGrid(int width, int height);
+
+    bool operator==(const BitGrid& rhs) const;
+
+    void blit(const BitGrid& source, int colOffset, int rowOffset);
+    void clear();
+    void clearHalo();
+    template<Topology T>
+    void fillHalo();
+    static HaloFill haloFillFor(Topology topology);
+
+    ///
+    bool get(int col, int row) const {
+        return ((rowWords(row)[col / BITS_PER_WORD] >> (col % BITS_PER_WORD)) & 1U) != 0;
+    }
+
+    void set(int col, int row, bool alive);
+
+    /// Sets \p length live cells from \p col on, a word at a time; the run must fit the row
+    void setRun(int col, int row, int length) {
+        auto* words = rowWords(row);
+        while (length > 0) {
+            const auto bit = col % BITS_PER_WORD;
+            const auto span = std::min(BITS_PER_WORD - bit, length);
+            const auto mask = span == BITS_PER_WORD ? ~BitWord{0} : ((BitWord{1} << span) - 1);
+            words[col / BITS_PER_WORD] |= mask << bit;
+            col += span;
+            length -= span;
+        }
+    }
+
+    int getHeight() const;
+    int getWidth() const;
+    int getWordsPerRow() const;
+    BitWord getLastWordMask() const;
+    std::size_t getPopulation() const;
+
+    /// Returns the first data word of \p row; rows -1 and height address the guard rows
+    BitWord* rowWords(int row) {
+        return m_words.data() + static_cast<std::size_t>(row + 1) * m_stride + 1;
+    }
+
+    ///
+    const BitWord* rowWords(int row) const {
+        return m_words.data() + static_cast<std::size_t>(row + 1) * m_stride + 1;
+    }
+
+private:
+    int m_width{0};
+    int m_height{0};
+    int m_wordsPerRow{0};
+    int m_stride{0};
+    BitWord m_lastWordMask{0};
+    std::vector<BitWord> m_words;
+};
+}  // namespace gol
@@ -0,0 +1,200 @@
+/// \file Census.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Census.h"
+
+#include "BitGrid.h"
+#include "ObjectAnalysis.h"
+#include "SparseGrid.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gol {
+namespace {
+/// Batches handed to each thread per round; tallies are merged between rounds, so memory stays
+/// flat however many soups are searched
+constexpr int CENSUS_BATCHES_PER_THREAD{16};
+
+/// Objects found by the soups of one batch
+struct CensusTally {
+    std::map<std::string, std::uint64_t> objects;
+    std::uint64_t unsettled{0};
+    std::uint64_t generations{0};
+};
+
+/// True once the populations of the last 2 * CENSUS_MAX_PERIOD generations repeat with a
+/// period of CENSUS_MAX_PERIOD or less
+/// \note Population rather than state, so that gliders flying off do not keep a soup unsettled
+bool hasSettled(const std::vector<std::uint64_t>& populations) {
+    constexpr std::size_t WINDOW{2 * CENSUS_MAX_PERIOD};
+    if (populations.size() < WINDOW + CENSUS_MAX_PERIOD) {
+        return false;
+    }
+
+    const auto begin = populations.size() - WINDOW;
+    for (std::size_t period = 1; period <= CENSUS_MAX_PERIOD; ++period) {
+        auto repeats = true;
+        for (auto i = begin; i < populations.size() && repeats; ++i) {
+            repeats = populations[i] == populations[i - period];
+        }
+        if (repeats) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// Runs the soup seeded \p seed until it settles, and counts what it leaves behind
+void censusSoup(
+        std::uint64_t seed,
+        const CensusConfig& config,
+        const ObjectNamer& nameObjects,
+        CensusTally& tally) {
+    SparseGrid grid;
+    grid.setRule(config.rule);
+    // Centered in a chunk, so a small soup takes a while to spill into its neighbors
+    const auto offset = std::max((CHUNK_SIZE - config.soupSize) / 2, 0);
+    grid.pasteCells(
+            makeSoup(config.soupSize,
+                    config.soupSize,
+                    {seed, config.density, config.symmetry}),
+            offset,
+            offset);
+
+    std::vector<std::uint64_t> populations{grid.getPopulation()};
+    auto settled = false;
+    while (!settled && grid.getGeneration() < CENSUS_GENERATION_LIMIT) {
+        grid.step();
+        populations.push_back(grid.getPopulation());
+        settled = grid.getPopulation() == 0
+                || (grid.getGeneration() % CENSUS_MAX_PERIOD == 0 && hasSettled(populations));
+    }
+    tally.generations += grid.getGeneration();
+    if (!settled) {
+        ++tally.unsettled;
+        return;
+    }
+
+    for (const auto& name : nameObjects(grid.copyCells())) {
+        ++tally.objects[name];
+    }
+}
+}  // namespace
+
+///
+void printCensusReport(const CensusReport& report, std::ostream& out) {
+    const auto perSecond = [&report](double count) {
+        return report.seconds > 0.0 ? count / report.seconds : 0.0;
+    };
+
+    out << "Soups:            " << report.soups << " " << soupSymmetryName(report.symmetry)
+        << " (seeds " << report.firstSeed << " on)\n";
+    out << "Unsettled:        " << report.unsettled << "\n";
+    out << "Elapsed:          " << report.seconds << " s\n";
+    out << "Throughput:       " << perSecond(static_cast<double>(report.soups)) << " soups/s, "
+        << perSecond(static_cast<double>(report.soups)) / report.threadCount
+        << " soups/s per thread, " << perSecond(static_cast<double>(report.generations))
+        << " generations/s\n";
+
+    std::vector<std::pair<std::uint64_t, std::string>> counts;
+    for (const auto& [name, count] : report.objects) {
+        counts.emplace_back(count, name);
+    }
+    std::sort(counts.begin(), counts.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+    });
+
+    out << "Objects:\n";
+    for (const auto& [count, name] : counts) {
+        out << "  " << count << "\t" << name << "\n";
+    }
+    out << std::flush;
+}
+
+/// Runs config.soups soups and counts the objects they settle into by their apgcodes
+CensusReport runCensus(const CensusConfig& config) {
+    ObjectClassifier classifier(config.rule);
+    return runCensus(config, [&classifier](const BitGrid& cells) {
+        std::vector<std::string> names;
+        for (const auto& object : classifier.findObjects(cells)) {
+            names.push_back(object.identity.apgcode);
+        }
+        return names;
+    });
+}
+
+/// Runs config.soups soups on a thread pool, each thread taking the next batch of soups as
+/// it finishes its last, and counts the objects they settle into under the names
+/// \p nameObjects gives them
+/// \note Each soup depends only on its seed, so a census comes out the same on any number of
+/// threads
+CensusReport runCensus(const CensusConfig& config, const ObjectNamer& nameObjects) {
+    CensusReport report;
+    report.soups = config.soups;
+    report.firstSeed = config.firstSeed;
+    report.symmetry = config.symmetry;
+    report.threadCount = ThreadPool::resolveThreadCount(config.threadCount);
+    ThreadPool pool(report.threadCount);
+
+    const auto roundSoups = static_cast<std::uint64_t>(CENSUS_BATCH) * CENSUS_BATCHES_PER_THREAD
+            * static_cast<std::uint64_t>(report.threadCount);
+    std::vector<CensusTally> tallies;
+
+    using Clock = std::chrono::steady_clock;
+    const auto start = Clock::now();
+    for (std::uint64_t roundStart = 0; roundStart < config.soups; roundStart += roundSoups) {
+        const auto roundEnd = std::min(roundStart + roundSoups, config.soups);
+        const auto batches =
+                static_cast<int>((roundEnd - roundStart + CENSUS_BATCH - 1) / CENSUS_BATCH);
+        tallies.assign(batches, {});
+        pool.run(batches, [&](int batch) {
+            const auto first = roundStart + static_cast<std::uint64_t>(batch) * CENSUS_BATCH;
+            const auto last = std::min<std::uint64_t>(first + CENSUS_BATCH, roundEnd);
+            for (auto soup = first; soup < last; ++soup) {
+                censusSoup(config.firstSeed + soup, config, nameObjects, tallies[batch]);
+            }
+        });
+
+        for (const auto& tally : tallies) {
+            report.unsettled += tally.unsettled;
+            report.generations += tally.generations;
+            for (const auto& [name, count] : tally.objects) {
+                report.objects[name] += count;
+            }
+        }
+    }
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    report.seconds = elapsed.count();
+
+    return report;
+}
+}  // namespace gol
@@ -0,0 +1,78 @@
+/// \file Census.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+#include "Rule.h"
+#include "Soup.h"
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace gol {
+/// Cells per side of a census soup, as in apgsearch's C1 soups
+constexpr int SOUP_SIZE{16};
+/// Soups handed to a thread at a time; small enough that a few slow soups cannot leave the
+/// other threads idle, large enough that handing them out costs next to nothing
+constexpr int CENSUS_BATCH{32};
+/// Longest period a settled soup is checked for
+constexpr int CENSUS_MAX_PERIOD{60};
+/// Generations a soup may run before it is given up on as never settling
+constexpr std::uint64_t CENSUS_GENERATION_LIMIT{20000};
+
+/// What to search: soups seeded firstSeed, firstSeed + 1, and so on
+struct CensusConfig {
+    std::uint64_t soups{1000};
+    std::uint64_t firstSeed{0};
+    int soupSize{SOUP_SIZE};
+    double density{SOUP_DENSITY};
+    SoupSymmetry symmetry{SoupSymmetry::C1};
+    /// 0 uses every hardware thread
+    int threadCount{0};
+    Rule rule;
+};
+
+/// What a census found: each object's name and how many of it were left when soups settled
+struct CensusReport {
+    std::uint64_t soups{0};
+    std::uint64_t firstSeed{0};
+    SoupSymmetry symmetry{SoupSymmetry::C1};
+    /// Soups still changing after CENSUS_GENERATION_LIMIT generations, left out of the counts
+    std::uint64_t unsettled{0};
+    std::uint64_t generations{0};
+    double seconds{0.0};
+    int threadCount{1};
+    std::map<std::string, std::uint64_t> objects;
+};
+
+/// Names every object a settled soup left in \p cells; a census counts whatever names it is
+/// given, and calls this from all its threads at once
+using ObjectNamer = std::function<std::vector<std::string>(const BitGrid& cells)>;
+
+void printCensusReport(const CensusReport& report, std::ostream& out);
+CensusReport runCensus(const CensusConfig& config);
+CensusReport runCensus(const CensusConfig& config, const ObjectNamer& nameObjects);
+}  // namespace gol
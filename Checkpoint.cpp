@@ -0,0 +1,380 @@
+/// \file Checkpoint.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Checkpoint.h"
+
+#include "GOLFile.h"
+#include "MappedFile.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+namespace gol {
+namespace {
+/// Seven bytes of magic, then the format version
+constexpr char CHECKPOINT_MAGIC[]{"GOLCKPT"};
+constexpr std::uint8_t CHECKPOINT_VERSION{1};
+
+constexpr std::uint64_t FNV_OFFSET_BASIS{0xCBF29CE484222325ULL};
+constexpr std::uint64_t FNV_PRIME{0x100000001B3ULL};
+
+/// FNV-1a of \p bytes
+std::uint64_t checksum(std::string_view bytes) {
+    auto hash = FNV_OFFSET_BASIS;
+    for (auto byte : bytes) {
+        hash = (hash ^ static_cast<std::uint8_t>(byte)) * FNV_PRIME;
+    }
+    return hash;
+}
+
+/// Appends \p value to \p out, least significant byte first
+template<typename T>
+void putBytes(std::string& out, T value) {
+    auto bits = static_cast<std::uint64_t>(value);
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out += static_cast<char>(bits & 0xFFU);
+        bits >>= 8;
+    }
+}
+
+/// Appends \p value to \p out seven bits at a time, lowest first, the top bit of each byte
+/// set while more follow
+void putVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80U) {
+        out += static_cast<char>((value & 0x7FU) | 0x80U);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+/// Reads back what putBytes() and putVarint() wrote, failing for good at the first read past
+/// the end
+class ByteReader {
+public:
+    explicit ByteReader(std::string_view bytes)
+        : m_bytes(bytes) {}
+
+    template<typename T>
+    T get() {
+        if (m_bytes.size() - m_pos < sizeof(T)) {
+            m_failed = true;
+            return T{};
+        }
+
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            bits |= std::uint64_t{static_cast<std::uint8_t>(m_bytes[m_pos++])} << (8 * i);
+        }
+        return static_cast<T>(bits);
+    }
+
+    std::uint64_t getVarint() {
+        std::uint64_t value = 0;
+        for (auto shift = 0; shift < 64; shift += 7) {
+            if (m_pos == m_bytes.size()) {
+                break;
+            }
+
+            const auto byte = static_cast<std::uint8_t>(m_bytes[m_pos++]);
+            value |= std::uint64_t{byte & 0x7FU} << shift;
+            if ((byte & 0x80U) == 0) {
+                return value;
+            }
+        }
+
+        m_failed = true;
+        return 0;
+    }
+
+    bool failed() const {
+        return m_failed;
+    }
+
+    bool isAtEnd() const {
+        return m_pos == m_bytes.size();
+    }
+
+private:
+    std::string_view m_bytes;
+    std::size_t m_pos{0};
+    bool m_failed{false};
+};
+
+/// Word \p index of the grid's cells, counting row by row, with the bits past the last column
+/// masked off
+BitWord cellWord(const BitGrid& cells, std::size_t index) {
+    const auto wordsPerRow = static_cast<std::size_t>(cells.getWordsPerRow());
+    const auto row = static_cast<int>(index / wordsPerRow);
+    const auto col = index % wordsPerRow;
+    const auto word = cells.rowWords(row)[col];
+    return col == wordsPerRow - 1 ? word & cells.getLastWordMask() : word;
+}
+
+/// Runs of zero words are written as a count alone; every other run as a count and its words
+/// \note Alternates a varint count of zero words with a varint count of literal words and the
+/// literal words themselves, until every word of the grid is accounted for
+void encodeCells(const BitGrid& cells, std::string& out) {
+    const auto numWords = static_cast<std::size_t>(cells.getWordsPerRow())
+            * static_cast<std::size_t>(cells.getHeight());
+    std::size_t index = 0;
+    while (index < numWords) {
+        auto zeros = index;
+        while (zeros < numWords && cellWord(cells, zeros) == 0) {
+            ++zeros;
+        }
+        auto literals = zeros;
+        while (literals < numWords && cellWord(cells, literals) != 0) {
+            ++literals;
+        }
+
+        putVarint(out, zeros - index);
+        putVarint(out, literals - zeros);
+        for (auto i = zeros; i < literals; ++i) {
+            putBytes(out, cellWord(cells, i));
+        }
+        index = literals;
+    }
+}
+
+/// False if the runs overrun the grid, or the bytes run out first
+bool decodeCells(ByteReader& reader, BitGrid& cells) {
+    const auto wordsPerRow = static_cast<std::size_t>(cells.getWordsPerRow());
+    const auto numWords = wordsPerRow * static_cast<std::size_t>(cells.getHeight());
+    std::size_t index = 0;
+    while (index < numWords && !reader.failed()) {
+        const auto zeros = reader.getVarint();
+        const auto literals = reader.getVarint();
+        if (zeros > numWords - index || literals > numWords - index - zeros) {
+            return false;
+        }
+
+        index += zeros;
+        for (std::uint64_t i = 0; i < literals; ++i, ++index) {
+            cells.rowWords(static_cast<int>(index / wordsPerRow))[index % wordsPerRow] =
+                    reader.get<BitWord>();
+        }
+    }
+
+    // Bits past the last column belong to no cell
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        cells.rowWords(row)[wordsPerRow - 1] &= cells.getLastWordMask();
+    }
+
+    return index == numWords && !reader.failed();
+}
+}  // namespace
+
+/// Reads a checkpoint written by writeCheckpoint(); nothing if the file is missing, of another
+/// version, or damaged
+/// \see writeCheckpoint() for the layout
+std::optional<Checkpoint> readCheckpoint(const std::string& filename) {
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        std::cerr << "Couldn't read checkpoint " << filename << std::endl;
+        return std::nullopt;
+    }
+
+    const auto bytes = file.view();
+    const std::string_view magic(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC) - 1);
+    if (!bytes.starts_with(magic) || bytes.size() < magic.size() + 1 + sizeof(std::uint64_t)) {
+        std::cerr << "Not a checkpoint: " << filename << std::endl;
+        return std::nullopt;
+    }
+
+    if (static_cast<std::uint8_t>(bytes[magic.size()]) != CHECKPOINT_VERSION) {
+        std::cerr << "Unsupported checkpoint version in " << filename << std::endl;
+        return std::nullopt;
+    }
+
+    const auto payload = bytes.substr(0, bytes.size() - sizeof(std::uint64_t));
+    ByteReader trailer(bytes.substr(payload.size()));
+    if (trailer.get<std::uint64_t>() != checksum(payload)) {
+        std::cerr << "Checkpoint is damaged: " << filename << std::endl;
+        return std::nullopt;
+    }
+
+    ByteReader reader(payload.substr(magic.size() + 1));
+    Checkpoint checkpoint;
+    const auto topology = reader.get<std::uint8_t>();
+    checkpoint.unbounded = reader.get<std::uint8_t>() != 0;
+    const auto birthCounts = reader.get<std::uint16_t>();
+    const auto survivalCounts = reader.get<std::uint16_t>();
+    checkpoint.width = static_cast<int>(reader.get<std::uint32_t>());
+    checkpoint.height = static_cast<int>(reader.get<std::uint32_t>());
+    checkpoint.generation = reader.get<std::uint64_t>();
+    checkpoint.viewportLeft = reader.get<std::int64_t>();
+    checkpoint.viewportTop = reader.get<std::int64_t>();
+    checkpoint.cellsLeft = reader.get<std::int64_t>();
+    checkpoint.cellsTop = reader.get<std::int64_t>();
+    const auto cellsWidth = static_cast<int>(reader.get<std::uint32_t>());
+    const auto cellsHeight = static_cast<int>(reader.get<std::uint32_t>());
+
+    // A bounded grid's cells are the grid itself; B0 rules are never stepped
+    const auto limit = (1U << NEIGHBOR_COUNTS) - 1;
+    if (reader.failed() || topology > static_cast<std::uint8_t>(Topology::CROSS_SURFACE)
+        || (birthCounts & ~limit) != 0 || (survivalCounts & ~limit) != 0
+        || (birthCounts & 1U) != 0 || checkpoint.width <= 0 || checkpoint.height <= 0
+        || cellsWidth <= 0 || cellsHeight <= 0
+        || static_cast<std::uint64_t>(cellsWidth) * static_cast<std::uint64_t>(cellsHeight)
+                   > MAX_RLE_CELLS
+        || (!checkpoint.unbounded
+            && (cellsWidth != checkpoint.width || cellsHeight != checkpoint.height))) {
+        std::cerr << "Invalid checkpoint header in " << filename << std::endl;
+        return std::nullopt;
+    }
+
+    checkpoint.topology = static_cast<Topology>(topology);
+    checkpoint.rule = Rule(birthCounts, survivalCounts);
+    checkpoint.cells = BitGrid(cellsWidth, cellsHeight);
+    if (!decodeCells(reader, checkpoint.cells) || !reader.isAtEnd()) {
+        std::cerr << "Checkpoint cells are damaged: " << filename << std::endl;
+        return std::nullopt;
+    }
+
+    std::clog << "Resuming " << filename << " at generation " << checkpoint.generation << ", "
+              << checkpoint.cells.getPopulation() << " live cells" << std::endl;
+    return checkpoint;
+}
+
+/// Writes \p checkpoint to \p filename, replacing it only once the whole file is written
+/// \note The layout, every number least significant byte first:
+/// - "GOLCKPT" and a version byte
+/// - topology, unbounded (a byte each), birth and survival counts (16 bits each)
+/// - width and height (32 bits each), generation (64 bits)
+/// - viewport left and top, cells left and top (64 bits each, signed)
+/// - cells width and height (32 bits each)
+/// - the cells' words, row by row, as runs of zero words and runs of literal words
+/// - FNV-1a of everything before it (64 bits)
+///
+/// The file is written beside its final name and renamed over it, so a crash mid-write leaves
+/// the previous checkpoint whole.
+bool writeCheckpoint(const std::string& filename, const Checkpoint& checkpoint) {
+    const auto start = std::chrono::steady_clock::now();
+
+    std::string bytes(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC) - 1);
+    putBytes(bytes, CHECKPOINT_VERSION);
+    putBytes(bytes, static_cast<std::uint8_t>(checkpoint.topology));
+    putBytes(bytes, static_cast<std::uint8_t>(checkpoint.unbounded ? 1 : 0));
+    putBytes(bytes, checkpoint.rule.getBirthCounts());
+    putBytes(bytes, checkpoint.rule.getSurvivalCounts());
+    putBytes(bytes, static_cast<std::uint32_t>(checkpoint.width));
+    putBytes(bytes, static_cast<std::uint32_t>(checkpoint.height));
+    putBytes(bytes, checkpoint.generation);
+    putBytes(bytes, checkpoint.viewportLeft);
+    putBytes(bytes, checkpoint.viewportTop);
+    putBytes(bytes, checkpoint.cellsLeft);
+    putBytes(bytes, checkpoint.cellsTop);
+    putBytes(bytes, static_cast<std::uint32_t>(checkpoint.cells.getWidth()));
+    putBytes(bytes, static_cast<std::uint32_t>(checkpoint.cells.getHeight()));
+    encodeCells(checkpoint.cells, bytes);
+    putBytes(bytes, checksum(bytes));
+
+    const auto partial = filename + ".partial";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        out.close();
+        if (!out) {
+            std::cerr << "Couldn't write checkpoint " << partial << std::endl;
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(partial, filename, error);
+    if (error) {
+        std::cerr << "Couldn't replace checkpoint " << filename << ": " << error.message()
+                  << std::endl;
+        return false;
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+    std::clog << "Checkpointed generation " << checkpoint.generation << " to " << filename
+              << ", " << bytes.size() << " bytes in " << elapsed.count() << " ms" << std::endl;
+    return true;
+}
+
+///
+Checkpointer::Checkpointer()
+    : m_thread(&Checkpointer::run, this) {}
+
+/// \note Writes whatever is still waiting before returning
+Checkpointer::~Checkpointer() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    m_thread.join();
+}
+
+/// Waits until every checkpoint submitted so far is written
+void Checkpointer::flush() {
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock, [this] { return !m_pending.has_value() && !m_writing; });
+}
+
+/// \note Returns at once; the checkpoint is written on the checkpointer's own thread
+void Checkpointer::submit(const std::string& filename, Checkpoint checkpoint) {
+    {
+        std::lock_guard lock(m_mutex);
+        m_pending = std::move(checkpoint);
+        m_pendingFilename = filename;
+    }
+    m_wake.notify_all();
+}
+
+/// \note PRIVATE
+void Checkpointer::run() {
+    std::unique_lock lock(m_mutex);
+    for (;;) {
+        m_wake.wait(lock, [this] { return m_pending.has_value() || m_stopping; });
+        if (!m_pending.has_value()) {
+            return;
+        }
+
+        auto checkpoint = std::move(m_pending.value());
+        auto filename = std::move(m_pendingFilename);
+        m_pending.reset();
+        m_writing = true;
+
+        lock.unlock();
+        writeCheckpoint(filename, checkpoint);
+        lock.lock();
+
+        m_writing = false;
+        m_idle.notify_all();
+    }
+}
+}  // namespace gol
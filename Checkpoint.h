@@ -0,0 +1,87 @@
+/// \file Checkpoint.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+#include "Rule.h"
+#include "Topology.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace gol {
+
+constexpr char CHECKPOINT[]{"ckpt"};
+
+/// Everything a run needs to carry on from one generation
+/// \note A bounded grid's cells are the whole grid; an unbounded plane's are cropped to its live
+/// cells, with their top left corner at (cellsLeft, cellsTop) of the plane, and the width and
+/// height are those of the viewport
+struct Checkpoint {
+    BitGrid cells;
+    std::int64_t cellsLeft{0};
+    std::int64_t cellsTop{0};
+    int width{0};
+    int height{0};
+    Topology topology{Topology::BOUNDED};
+    bool unbounded{false};
+    Rule rule;
+    std::uint64_t generation{0};
+    std::int64_t viewportLeft{0};
+    std::int64_t viewportTop{0};
+};
+
+std::optional<Checkpoint> readCheckpoint(const std::string& filename);
+bool writeCheckpoint(const std::string& filename, const Checkpoint& checkpoint);
+
+/// Writes checkpoints on a thread of its own, so the thread stepping the grid only pays for
+/// copying one
+/// \note Only the newest checkpoint waiting to be written is kept: one submitted while an older
+/// one still waits replaces it. Whatever is waiting is written before destruction completes.
+class Checkpointer {
+public:
+    Checkpointer();
+    ~Checkpointer();
+
+    Checkpointer(const Checkpointer&) = delete;
+    Checkpointer& operator=(const Checkpointer&) = delete;
+
+    void flush();
+    void submit(const std::string& filename, Checkpoint checkpoint);
+
+private:
+    void run();
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_idle;
+    std::optional<Checkpoint> m_pending;
+    std::string m_pendingFilename;
+    bool m_writing{false};
+    bool m_stopping{false};
+    std::thread m_thread;
+};
+}  // namespace gol
@@ -0,0 +1,108 @@
+/// \file ConwayCell.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "ConwayCell.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace gol {
+
+/// \note Every cell starts dead and asleep
+CellArray::CellArray(int width, int height, Topology topology)
+    : m_width(width)
+    , m_height(height)
+    , m_topology(topology)
+    , m_states(static_cast<std::size_t>(width) * height, 0)
+    , m_pendingStates(m_states.size(), CELL_ASLEEP) {}
+
+/// \note Maps each neighbor through the topology; step() reads the neighbors of cells clear of
+/// every edge without it
+int CellArray::countLivingNeighbors(int col, int row) const {
+    auto numLivingNeighbors = 0;
+    forEachNeighbor(col, row, m_width, m_height, m_topology, [&](int neighborCol, int neighborRow) {
+        numLivingNeighbors += m_states[indexOf(neighborCol, neighborRow)];
+    });
+
+    return numLivingNeighbors;
+}
+
+///
+bool CellArray::empty() const {
+    return m_states.empty();
+}
+
+///
+int CellArray::getHeight() const {
+    return m_height;
+}
+
+///
+Topology CellArray::getTopology() const {
+    return m_topology;
+}
+
+///
+int CellArray::getWidth() const {
+    return m_width;
+}
+
+///
+void CellArray::set(int col, int row, bool alive, CellPending pendingState) {
+    const auto index = indexOf(col, row);
+    m_states[index] = alive ? 1 : 0;
+    m_pendingStates[index] = static_cast<std::uint8_t>(pendingState);
+}
+
+/// Steps every cell one generation under \p rule, one cell at a time
+/// \note Cells clear of every edge add up the rows above and below in place; only the border
+/// goes through countLivingNeighbors()
+void CellArray::step(const Rule& rule) {
+    m_nextStates.resize(m_states.size());
+    for (auto row = 0; row < m_height; ++row) {
+        const bool isInteriorRow = row > 0 && row < m_height - 1;
+        for (auto col = 0; col < m_width; ++col) {
+            const auto index = indexOf(col, row);
+            auto numLivingNeighbors = 0;
+            if (isInteriorRow && col > 0 && col < m_width - 1) {
+                const auto* above = &m_states[index - m_width];
+                const auto* here = &m_states[index];
+                const auto* below = &m_states[index + m_width];
+                numLivingNeighbors = above[-1] + above[0] + above[1] + here[-1] + here[1]
+                        + below[-1] + below[0] + below[1];
+            } else {
+                numLivingNeighbors = countLivingNeighbors(col, row);
+            }
+
+            const bool wasAlive = m_states[index] != 0;
+            const bool alive =
+                    wasAlive ? rule.survives(numLivingNeighbors) : rule.isBorn(numLivingNeighbors);
+            m_nextStates[index] = alive ? 1 : 0;
+            m_pendingStates[index] =
+                    static_cast<std::uint8_t>(pendingStateOf(wasAlive, alive, numLivingNeighbors));
+        }
+    }
+
+    std::swap(m_states, m_nextStates);
+}
+}  // namespace gol
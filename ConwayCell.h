@@ -23,14 +23,76 @@
 #pragma once
 #include "ConwayDefs.h"
 #include "MooreNeighbor.h"
+#include "Rule.h"
+#include "Topology.h"
 
-#include <algorithm>
-#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace gol {
 
-///
+/// What a cell shows after a transition, from its state before and after it and its live
+/// neighbors
+/// \note As in ConwayGrid, a dead cell with four or more neighbors shows as choked, whatever
+/// the rule
+inline CellPending pendingStateOf(bool wasAlive, bool isAlive, int numLivingNeighbors) {
+    if (isAlive) {
+        return wasAlive ? CELL_LIVING : CELL_REBORN;
+    }
+    if (numLivingNeighbors >= 4) {
+        return CELL_CHOKED;
+    }
+
+    return wasAlive ? CELL_LONELY : CELL_ASLEEP;
+}
+
+/// The state and pending state of every cell of a grid, a byte each in flat arrays, row by row
+/// \note Neighbors are found from a cell's position as they are needed rather than kept per
+/// cell: cells clear of every edge read the rows above and below in place, and only the
+/// border maps its neighbors through the topology
+class CellArray {
+public:
+    CellArray() = default;
+    CellArray(int width, int height, Topology topology = Topology::BOUNDED);
+
+    int countLivingNeighbors(int col, int row) const;
+    bool empty() const;
+    int getHeight() const;
+    Topology getTopology() const;
+    int getWidth() const;
+    void set(int col, int row, bool alive, CellPending pendingState);
+    void step(const Rule& rule = Rule());
+
+    ///
+    CellPending getPendingState(int col, int row) const {
+        return static_cast<CellPending>(m_pendingStates[indexOf(col, row)]);
+    }
+
+    ///
+    bool isAlive(int col, int row) const {
+        return m_states[indexOf(col, row)] != 0;
+    }
+
+private:
+    ///
+    std::size_t indexOf(int col, int row) const {
+        return static_cast<std::size_t>(row) * m_width + col;
+    }
+
+    int m_width{0};
+    int m_height{0};
+    Topology m_topology{Topology::BOUNDED};
+    std::vector<std::uint8_t> m_states;
+    std::vector<std::uint8_t> m_pendingStates;
+    /// Kept between steps, so that stepping allocates nothing
+    std::vector<std::uint8_t> m_nextStates;
+};
+
+/// One cell of a grid of \p gridW by \p gridH
+/// \note Its neighbors are found from its position when they are needed, so a cell is a few
+/// words with nothing on the heap
 class ConwayCell {
 public:
     ConwayCell() = delete;
@@ -43,15 +105,23 @@ public:
             int gridH,
             bool alive = false,
             bool wrapped = false)
+        : ConwayCell(
+                  cellCol,
+                  cellRow,
+                  gridW,
+                  gridH,
+                  alive,
+                  wrapped ? Topology::TORUS : Topology::BOUNDED) {}
+
+    ///
+    ConwayCell(int cellCol, int cellRow, int gridW, int gridH, bool alive, Topology topology)
         : m_cellCol(cellCol)
         , m_cellRow(cellRow)
         , m_gridW(gridW)
         , m_gridH(gridH)
         , m_isAlive(alive)
-        , m_wrapped(wrapped)
-        , m_pendingState(m_isAlive ? CELL_LIVING : CELL_ASLEEP) {
-        m_neighbors = mooreNeighborhood(cellCol, cellRow, gridW, gridH, wrapped);
-    }
+        , m_topology(topology)
+        , m_pendingState(m_isAlive ? CELL_LIVING : CELL_ASLEEP) {}
 
     ///
     bool operator==(const ConwayCell& rhs) const {
@@ -59,17 +129,16 @@ public:
                 && m_isAlive == rhs.m_isAlive && m_pendingState == rhs.m_pendingState);
     }
 
-    ///
-    bool computeNextState(const CellArray& snapshot) {
+    /// \note Reads the neighbors' states from \p snapshot in place
+    bool computeNextState(const CellArray& snapshot, const Rule& rule = Rule()) {
         auto numLivingNeighbors = 0;
-        for (const auto& [col, row] : m_neighbors) {
-            auto cell = snapshot[row][col];
-            if (cell.m_isAlive) {
-                ++numLivingNeighbors;
-            }
-        }
-
-        m_pendingState = setPendingState(numLivingNeighbors);
+        forEachNeighbor(m_cellCol, m_cellRow, m_gridW, m_gridH, m_topology, [&](int col, int row) {
+            numLivingNeighbors += snapshot.isAlive(col, row) ? 1 : 0;
+        });
+
+        const bool wasAlive = m_isAlive;
+        m_isAlive = wasAlive ? rule.survives(numLivingNeighbors) : rule.isBorn(numLivingNeighbors);
+        m_pendingState = pendingStateOf(wasAlive, m_isAlive, numLivingNeighbors);
         return m_isAlive;
     }
 
@@ -80,13 +149,22 @@ public:
 
     ///
     std::size_t getNumNeighbors() const {
-        return m_neighbors.size();
+        std::size_t numNeighbors = 0;
+        forEachNeighbor(m_cellCol, m_cellRow, m_gridW, m_gridH, m_topology, [&](int, int) {
+            ++numNeighbors;
+        });
+        return numNeighbors;
     }
 
     std::pair<int, int> getRowCol() const {
         return {m_cellCol, m_cellRow};
     }
 
+    ///
+    void setPendingState(CellPending pendingState) {
+        m_pendingState = pendingState;
+    }
+
     ///
     bool isAlive() const {
         return m_isAlive;
@@ -98,46 +176,12 @@ public:
     }
 
 private:
-    ///
-    CellPending setPendingState(int numLivingNeighbors) {
-        CellPending pendingState = CELL_ASLEEP;
-
-        switch (numLivingNeighbors) {
-        case 0:
-        case 1:
-            if (m_isAlive) {
-                m_isAlive = false;
-                pendingState = CELL_LONELY;
-            }
-            break;
-        case 2:
-            pendingState = m_isAlive ? CELL_LIVING : CELL_ASLEEP;
-            break;
-        case 3:
-            if (m_isAlive) {
-                pendingState = CELL_LIVING;
-            } else {
-                pendingState = CELL_REBORN;
-                m_isAlive = true;
-            }
-            break;
-        default:
-            pendingState = CELL_CHOKED;
-            m_isAlive = false;
-            break;
-        }
-
-        return pendingState;
-    }
-
     int m_cellCol{0};
     int m_cellRow{0};
     int m_gridW{0};
     int m_gridH{0};
     bool m_isAlive{false};
-    bool m_wrapped{false};
+    Topology m_topology{Topology::BOUNDED};
     CellPending m_pendingState{CELL_ASLEEP};
-
-    NeighborArray m_neighbors;
 };
 }  // namespace gol
\ No newline at end of file
@@ -27,9 +27,7 @@
 #include <vector>
 
 namespace gol {
-class ConwayCell;
-using CellRow = std::vector<ConwayCell>;
-using CellArray = std::vector<CellRow>;
+class CellArray;
 
 using PatternArray = std::vector<std::string>;
 using ScreenSize = std::pair<unsigned int, unsigned int>;
@@ -21,44 +21,68 @@
 // SOFTWARE.
 #include "ConwayGrid.h"
 
+#include "BitGrid.h"
 #include "ConwayDefs.h"
+#include "CycleDetector.h"
 #include "GOLFile.h"
-
-#include <effolkronium/random.hpp>
+#include "GridView.h"
+#include "LifeKernel.h"
+#include "Soup.h"
+#include "ThreadPool.h"
 
 #include <algorithm>
-#include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <iostream>
-#include <iterator>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-using namespace effolkronium;
-
 namespace gol {
+namespace {
+/// XOR of hashWord() over every word of \p cells
+std::uint64_t hashCells(const BitGrid& cells) {
+    const auto lastWord = cells.getWordsPerRow() - 1;
+    std::uint64_t stateHash = 0;
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        const auto* words = cells.rowWords(row);
+        for (auto word = 0; word < lastWord; ++word) {
+            stateHash ^= hashWord(word, row, words[word]);
+        }
+        stateHash ^= hashWord(lastWord, row, words[lastWord] & cells.getLastWordMask());
+    }
 
-///
-ConwayGrid::ConwayGrid(ScreenSize screenSize, bool wrapped)
+    return stateHash;
+}
+}  // namespace
+
+/// \note A half-full soup from a fresh seed; see the BitGrid constructor and makeSoup() for
+/// one that can be drawn again
+ConwayGrid::ConwayGrid(ScreenSize screenSize, Topology topology, KernelType kernel)
     : m_width(screenSize.first)
     , m_height(screenSize.second)
-    , m_wrapped(wrapped) {
-    for (auto i = 0; i < m_height; ++i) {
-        auto rando = random_static::get<std::vector>(PTEXT_LIVE, PTEXT_ALT_DEAD, m_width);
-        m_patternArray.emplace_back(rando.begin(), rando.end());
-    }
-
-    populatePendingGrid();
-    m_snapshot.reserve(static_cast<std::size_t>(m_height));
+    , m_topology(topology)
+    , m_fillHalo(BitGrid::haloFillFor(topology))
+    , m_kernel(resolveKernel(kernel)) {
+    seedGenerations(makeSoup(m_width, m_height, {randomSeed()}));
 }
 
+/// \note A wrapped grid is a torus
+ConwayGrid::ConwayGrid(ScreenSize screenSize, bool wrapped, KernelType kernel)
+    : ConwayGrid(screenSize, wrapped ? Topology::TORUS : Topology::BOUNDED, kernel) {}
+
 ///
-ConwayGrid::ConwayGrid(PatternArray patternArray, ScreenSize padding, bool wrapped)
+ConwayGrid::ConwayGrid(
+        PatternArray patternArray,
+        ScreenSize padding,
+        Topology topology,
+        KernelType kernel)
     : m_patternArray(std::move(patternArray))
     , m_padding(std::move(padding))
-    , m_wrapped(wrapped) {
+    , m_topology(topology)
+    , m_fillHalo(BitGrid::haloFillFor(topology))
+    , m_kernel(resolveKernel(kernel)) {
 
     m_height = m_patternArray.size();
     m_width = m_patternArray.empty() ? 0 : m_patternArray[0].length();
@@ -70,32 +94,247 @@ ConwayGrid::ConwayGrid(PatternArray patternArray, ScreenSize padding, bool wrapp
 
     fitGridToWindow();
     populatePendingGrid();
+}
 
-    m_snapshot.reserve(static_cast<std::size_t>(m_height));
+/// \note A wrapped grid is a torus
+ConwayGrid::ConwayGrid(
+        PatternArray patternArray,
+        ScreenSize padding,
+        bool wrapped,
+        KernelType kernel)
+    : ConwayGrid(
+              std::move(patternArray),
+              std::move(padding),
+              wrapped ? Topology::TORUS : Topology::BOUNDED,
+              kernel) {}
+
+/// \note The cells are centered in a grid of at least \p padding, as a pattern array is
+ConwayGrid::ConwayGrid(
+        const BitGrid& cells,
+        ScreenSize padding,
+        Topology topology,
+        KernelType kernel)
+    : m_width(std::max(cells.getWidth(), static_cast<int>(padding.first)))
+    , m_height(std::max(cells.getHeight(), static_cast<int>(padding.second)))
+    , m_padding(std::move(padding))
+    , m_topology(topology)
+    , m_fillHalo(BitGrid::haloFillFor(topology))
+    , m_kernel(resolveKernel(kernel)) {
+
+    if (cells.getWidth() == 0 || cells.getHeight() == 0) {
+        std::cerr << "Error: Empty bit grid provided to ConwayGrid" << std::endl;
+        return;
+    }
+
+    BitGrid initial(m_width, m_height);
+    initial.blit(cells, (m_width - cells.getWidth()) / 2, (m_height - cells.getHeight()) / 2);
+    seedGenerations(initial);
 }
 
-///
-CellArray ConwayGrid::compute() {
-    copyPendingToSnapshot();
-    for (auto& cellRow : m_pending) {
-        for (auto& cell : cellRow) {
-            cell.isAlive(cell.computeNextState(m_snapshot));
+/// Carries on from \p checkpoint, at its generation and under its rule and topology
+/// \note The grid is the checkpoint's own size, with no padding to a window
+ConwayGrid::ConwayGrid(const Checkpoint& checkpoint, KernelType kernel)
+    : m_width(checkpoint.width)
+    , m_height(checkpoint.height)
+    , m_padding(checkpoint.width, checkpoint.height)
+    , m_topology(checkpoint.topology)
+    , m_fillHalo(BitGrid::haloFillFor(checkpoint.topology))
+    , m_kernel(resolveKernel(kernel))
+    , m_rule(checkpoint.rule) {
+    m_sparseGrid.setRule(m_rule);
+    if (checkpoint.unbounded) {
+        m_sparseGrid.pasteCells(checkpoint.cells, checkpoint.cellsLeft, checkpoint.cellsTop);
+        m_unbounded = true;
+        m_viewportLeft = checkpoint.viewportLeft;
+        m_viewportTop = checkpoint.viewportTop;
+        m_activeTiles = m_sparseGrid.getChunkCount();
+    } else {
+        seedGenerations(checkpoint.cells);
+    }
+
+    m_generation = checkpoint.generation;
+}
+
+/// \note Steps one generation and returns a view of it; nothing is copied or allocated
+GridView ConwayGrid::compute() {
+    step();
+    return getView();
+}
+
+/// \note Writes the CellPending of every cell, row by row, one byte each; a bounded grid
+/// decodes whole words at a time rather than probing cell by cell
+void ConwayGrid::copyPendingStates(std::uint8_t* states) const {
+    if (m_unbounded) {
+        for (auto row = 0; row < m_height; ++row) {
+            for (auto col = 0; col < m_width; ++col) {
+                *states++ = static_cast<std::uint8_t>(getPendingState(col, row));
+            }
         }
+        return;
     }
 
-    return m_pending;
+    for (auto row = 0; row < m_height; ++row) {
+        const auto* pendingRow = pending().rowWords(row);
+        const auto* snapshotRow = snapshot().rowWords(row);
+        const auto* chokedRow = m_choked.rowWords(row);
+        for (auto col = 0; col < m_width; col += BITS_PER_WORD) {
+            const auto word = col / BITS_PER_WORD;
+            const auto cells = std::min(BITS_PER_WORD, m_width - col);
+            for (auto bit = 0; bit < cells; ++bit) {
+                const bool alive = ((pendingRow[word] >> bit) & 1U) != 0;
+                const bool wasAlive = ((snapshotRow[word] >> bit) & 1U) != 0;
+                const bool choked = ((chokedRow[word] >> bit) & 1U) != 0;
+                *states++ = static_cast<std::uint8_t>(
+                        alive ? (wasAlive ? CELL_LIVING : CELL_REBORN)
+                              : (choked ? CELL_CHOKED : (wasAlive ? CELL_LONELY : CELL_ASLEEP)));
+            }
+        }
+    }
 }
 
 ///
 void ConwayGrid::dumpPendingGrid() const {
-    for (const auto& cellRow : m_pending) {
-        for (const auto& cell : cellRow) {
-            std::clog << (cell.isAlive() ? PTEXT_LIVE : PTEXT_DEAD);
+    for (auto row = 0; row < m_height; ++row) {
+        for (auto col = 0; col < m_width; ++col) {
+            std::clog << (isAlive(col, row) ? PTEXT_LIVE : PTEXT_DEAD);
         }
         std::clog << std::endl;
     }
 }
 
+/// Everything needed to carry on from the current generation
+/// \note Copies the cells, which is all the stepping thread need pay for a checkpoint; an
+/// unbounded grid is copied out of its chunks, cropped to its live cells
+Checkpoint ConwayGrid::makeCheckpoint() const {
+    Checkpoint checkpoint;
+    checkpoint.width = m_width;
+    checkpoint.height = m_height;
+    checkpoint.topology = m_topology;
+    checkpoint.unbounded = m_unbounded;
+    checkpoint.rule = m_rule;
+    checkpoint.generation = m_generation;
+    checkpoint.viewportLeft = m_viewportLeft;
+    checkpoint.viewportTop = m_viewportTop;
+    checkpoint.cells = m_unbounded
+            ? m_sparseGrid.copyCells(checkpoint.cellsLeft, checkpoint.cellsTop)
+            : pending();
+
+    return checkpoint;
+}
+
+/// \note Moves the cells onto a SparseGrid that grows without bound; the grid's own width and
+/// height become a viewport onto it, initially over the cells as they were
+void ConwayGrid::makeUnbounded() {
+    if (m_unbounded) {
+        return;
+    }
+
+    for (auto row = 0; row < m_height; ++row) {
+        for (auto col = 0; col < m_width; ++col) {
+            if (pending().get(col, row)) {
+                m_sparseGrid.setCell(col, row, true);
+            }
+        }
+    }
+
+    m_unbounded = true;
+    m_viewportLeft = 0;
+    m_viewportTop = 0;
+    m_generations = {};
+    m_choked = {};
+    m_tileActive.clear();
+    m_tileChanges.clear();
+    m_activeTiles = m_sparseGrid.getChunkCount();
+
+    std::clog << "Unbounded plane of " << m_sparseGrid.getChunkCount() << " chunks, "
+              << m_sparseGrid.getPopulation() << " live cells" << std::endl;
+}
+
+/// \note The two generations are swapped rather than copied: the last pending generation
+/// becomes the snapshot, and the one before it is overwritten with the next generation.
+/// Tile rows are handed out to the thread pool; each writes only its own rows of the pending
+/// and choked grids, and reads its neighbors' edge rows from the immutable snapshot
+void ConwayGrid::step() {
+    ++m_generation;
+    if (m_unbounded) {
+        m_sparseGrid.step();
+        m_activeTiles = m_sparseGrid.getChunkCount();
+        m_births = m_sparseGrid.getBirths();
+        m_deaths = m_sparseGrid.getDeaths();
+        return;
+    }
+
+    m_front ^= 1;
+
+    auto& snapshot = m_generations[m_front ^ 1];
+    (snapshot.*m_fillHalo)();
+    markActiveTiles();
+    if (m_threadPool && m_tilesHigh > 1) {
+        m_threadPool->run(m_tilesHigh, [this](int tileRow) { stepTileRow(tileRow); });
+    } else {
+        for (auto tileRow = 0; tileRow < m_tilesHigh; ++tileRow) {
+            stepTileRow(tileRow);
+        }
+    }
+    snapshot.clearHalo();
+
+    m_births = 0;
+    m_deaths = 0;
+    for (const auto& counts : m_tileRowCounts) {
+        m_births += counts.births;
+        m_deaths += counts.deaths;
+    }
+    if (m_tracksStateHash) {
+        for (auto tileRowHash : m_tileRowHashes) {
+            m_stateHash ^= tileRowHash;
+        }
+    }
+    m_population += m_births;
+    m_population -= m_deaths;
+}
+
+/// Hashes the whole grid once, then keeps the hash up to date from the words each step changes,
+/// for the grid's life; the steps of a grid nobody asks this of do no hashing at all
+/// \note An unbounded plane always keeps its hash
+void ConwayGrid::trackStateHash() {
+    if (!m_tracksStateHash && !m_unbounded) {
+        m_stateHash = hashCells(pending());
+    }
+    m_tracksStateHash = true;
+}
+
+///
+std::size_t ConwayGrid::getActiveTileCount() const {
+    return m_activeTiles;
+}
+
+/// \note Fraction of tiles recomputed by the last step; an unbounded grid steps every chunk
+double ConwayGrid::getActiveTileRatio() const {
+    auto tileCount = getTileCount();
+    return tileCount == 0 ? 0.0 : static_cast<double>(m_activeTiles) / tileCount;
+}
+
+/// \note Cells born by the last step
+std::uint64_t ConwayGrid::getBirths() const {
+    return m_births;
+}
+
+/// \note The current generation of a bounded grid, read in place; it changes as the grid is
+/// stepped. An unbounded grid keeps its cells in its plane, so see makeCheckpoint() instead
+const BitGrid& ConwayGrid::getCells() const {
+    return pending();
+}
+
+/// \note Cells that died in the last step
+std::uint64_t ConwayGrid::getDeaths() const {
+    return m_deaths;
+}
+
+///
+std::uint64_t ConwayGrid::getGeneration() const {
+    return m_generation;
+}
+
 ///
 int ConwayGrid::getGridHeight() const {
     return m_height;
@@ -107,20 +346,173 @@ int ConwayGrid::getGridWidth() const {
 }
 
 ///
+KernelType ConwayGrid::getKernelType() const {
+    return m_kernel;
+}
+
+/// \note Materializes the cells for inspection, two bytes each; use getView() on hot paths
 CellArray ConwayGrid::getPendingGrid() const {
-    return m_pending;
+    CellArray cells(m_width, m_height, m_topology);
+    for (auto row = 0; row < m_height; ++row) {
+        for (auto col = 0; col < m_width; ++col) {
+            cells.set(col, row, isAlive(col, row), getPendingState(col, row));
+        }
+    }
+
+    return cells;
 }
 
-///
+/// \note Derived from the last transition: the cell's state before and after it, plus
+/// whether the cell had four or more live neighbors
+CellPending ConwayGrid::getPendingState(int col, int row) const {
+    if (m_unbounded) {
+        return m_sparseGrid.getPendingState(m_viewportLeft + col, m_viewportTop + row);
+    }
+
+    auto wasAlive = snapshot().get(col, row);
+    if (pending().get(col, row)) {
+        return wasAlive ? CELL_LIVING : CELL_REBORN;
+    }
+
+    if (m_choked.get(col, row)) {
+        return CELL_CHOKED;
+    }
+
+    return wasAlive ? CELL_LONELY : CELL_ASLEEP;
+}
+
+/// \note Live cells of the pending generation, kept up to date from each step's births and
+/// deaths; an unbounded grid counts the whole plane
+std::uint64_t ConwayGrid::getPopulation() const {
+    return m_unbounded ? m_sparseGrid.getPopulation() : m_population;
+}
+
+/// \note Materializes the cells for inspection, two bytes each
 CellArray ConwayGrid::getSnapshotGrid() const {
-    return m_snapshot;
+    CellArray cells(m_width, m_height, m_topology);
+    for (auto row = 0; row < m_height; ++row) {
+        for (auto col = 0; col < m_width; ++col) {
+            const auto alive = wasAlive(col, row);
+            cells.set(col, row, alive, alive ? CELL_LIVING : CELL_ASLEEP);
+        }
+    }
+
+    return cells;
 }
 
-/// \note PRIVATE
-void ConwayGrid::copyPendingToSnapshot() {
-    m_snapshot.clear();
-    std::copy(m_pending.begin(), m_pending.end(), std::back_inserter(m_snapshot));
-    assert(m_pending == m_snapshot);
+/// \note Only kept up to date once trackStateHash() has been called; equal grids of the same
+/// size hash the same whatever their history
+std::uint64_t ConwayGrid::getStateHash() const {
+    return m_unbounded ? m_sparseGrid.getStateHash() : m_stateHash;
+}
+
+/// \note Valid for as long as the grid is; it tracks each new generation as it is stepped
+GridView ConwayGrid::getView() const {
+    return GridView(*this);
+}
+
+///
+const Rule& ConwayGrid::getRule() const {
+    return m_rule;
+}
+
+///
+int ConwayGrid::getThreadCount() const {
+    return m_threadPool ? m_threadPool->getThreadCount() : 1;
+}
+
+/// \note An unbounded grid counts its chunks as tiles
+std::size_t ConwayGrid::getTileCount() const {
+    if (m_unbounded) {
+        return m_sparseGrid.getChunkCount();
+    }
+
+    return static_cast<std::size_t>(m_tilesWide) * m_tilesHigh;
+}
+
+///
+Topology ConwayGrid::getTopology() const {
+    return m_topology;
+}
+
+///
+std::int64_t ConwayGrid::getViewportLeft() const {
+    return m_viewportLeft;
+}
+
+///
+std::int64_t ConwayGrid::getViewportTop() const {
+    return m_viewportTop;
+}
+
+/// \note For an unbounded grid, (col, row) is relative to the viewport
+bool ConwayGrid::isAlive(int col, int row) const {
+    if (m_unbounded) {
+        return m_sparseGrid.isAlive(m_viewportLeft + col, m_viewportTop + row);
+    }
+
+    return pending().get(col, row);
+}
+
+/// \note True once a step leaves every cell as it was, after which every later generation
+/// is the same; oscillators never settle this way
+bool ConwayGrid::isStill() const {
+    if (m_unbounded) {
+        return m_sparseGrid.isStill();
+    }
+
+    return std::all_of(
+            m_tileChanges.begin(), m_tileChanges.end(), [](BitWord word) { return word == 0; });
+}
+
+///
+bool ConwayGrid::isUnbounded() const {
+    return m_unbounded;
+}
+
+/// \note Takes effect from the next step; the unbounded plane follows the same rule
+void ConwayGrid::setRule(const Rule& rule) {
+    m_rule = rule;
+    m_sparseGrid.setRule(rule);
+    if (!m_unbounded) {
+        // Still tiles need not be still under the new rule
+        m_tileChanges.assign(getTileCount(), ~BitWord{0});
+    }
+    std::clog << "Stepping with rule " << m_rule.getName() << std::endl;
+}
+
+/// \note Zero or less uses every hardware thread; one steps on the calling thread alone
+void ConwayGrid::setThreadCount(int threadCount) {
+    threadCount = ThreadPool::resolveThreadCount(threadCount);
+    if (threadCount == getThreadCount()) {
+        return;
+    }
+
+    m_threadPool = threadCount > 1 ? std::make_shared<ThreadPool>(threadCount) : nullptr;
+    std::clog << "Stepping with " << threadCount << " thread" << (threadCount > 1 ? "s" : "")
+              << std::endl;
+}
+
+/// \note Moves the top left corner of an unbounded grid's viewport onto plane cell (left, top)
+void ConwayGrid::setViewport(std::int64_t left, std::int64_t top) {
+    m_viewportLeft = left;
+    m_viewportTop = top;
+}
+
+/// Writes the current generation under the grid's rule, as plaintext or RLE by extension
+/// \note An unbounded grid writes every live cell, cropped to their bounding box, rather than
+/// just the viewport
+bool ConwayGrid::writePatternFile(const std::string& filename) const {
+    GOLFile patternFile;
+    if (m_unbounded) {
+        return patternFile.writePatternFile(filename, m_sparseGrid.copyCells(), m_rule);
+    }
+    return patternFile.writePatternFile(filename, pending(), m_rule);
+}
+
+/// Writes the current generation to <prefix>_<generation>.rle
+bool ConwayGrid::writeSnapshot(const std::string& prefix) const {
+    return writePatternFile(prefix + "_" + std::to_string(getGeneration()) + "." + RLE);
 }
 
 /// \note PRIVATE
@@ -153,29 +545,172 @@ void ConwayGrid::fitGridToWindow() {
     }
 }
 
-///
+/// \note PRIVATE
+/// A tile can only change if it or one of its eight neighbors changed last generation;
+/// every other tile is left as is, and since it did not change, the generation being
+/// overwritten already holds its contents
+/// \note Beyond a twisted edge, a tile's neighbors are mirrored cells that need not line up
+/// with whole tiles, so a change on the edge of a Klein bottle or cross-surface wakes every
+/// tile around the border, where all of its halo cells come from
+void ConwayGrid::markActiveTiles() {
+    std::fill(m_tileActive.begin(), m_tileActive.end(), 0);
+
+    bool isBorderActive = false;
+    for (auto tileRow = 0; tileRow < m_tilesHigh; ++tileRow) {
+        for (auto tileCol = 0; tileCol < m_tilesWide; ++tileCol) {
+            if (m_tileChanges[tileRow * m_tilesWide + tileCol] == 0) {
+                continue;
+            }
+
+            for (auto rowOffset = -1; rowOffset <= 1; ++rowOffset) {
+                for (auto colOffset = -1; colOffset <= 1; ++colOffset) {
+                    auto row = tileRow + rowOffset;
+                    auto col = tileCol + colOffset;
+                    if (row < 0 || row >= m_tilesHigh || col < 0 || col >= m_tilesWide) {
+                        if (m_topology == Topology::BOUNDED) {
+                            continue;
+                        }
+                        if (m_topology != Topology::TORUS) {
+                            isBorderActive = true;
+                            continue;
+                        }
+                        row = (row + m_tilesHigh) % m_tilesHigh;
+                        col = (col + m_tilesWide) % m_tilesWide;
+                    }
+                    m_tileActive[row * m_tilesWide + col] = 1;
+                }
+            }
+        }
+    }
+
+    if (isBorderActive) {
+        for (auto tileCol = 0; tileCol < m_tilesWide; ++tileCol) {
+            m_tileActive[tileCol] = 1;
+            m_tileActive[(m_tilesHigh - 1) * m_tilesWide + tileCol] = 1;
+        }
+        for (auto tileRow = 0; tileRow < m_tilesHigh; ++tileRow) {
+            m_tileActive[tileRow * m_tilesWide] = 1;
+            m_tileActive[tileRow * m_tilesWide + m_tilesWide - 1] = 1;
+        }
+    }
+
+    m_activeTiles = std::count(m_tileActive.begin(), m_tileActive.end(), 1);
+}
+
+/// \note PRIVATE
+const BitGrid& ConwayGrid::pending() const {
+    return m_generations[m_front];
+}
+
+/// \note PRIVATE
 void ConwayGrid::populatePendingGrid() {
-    auto liveCount = 0;
+    BitGrid initial(m_width, m_height);
+
     auto row = 0;
     for (const auto& patternRow : m_patternArray) {
-        auto col = 0;
-        CellRow cellRow{};
-        cellRow.reserve(m_width);
-        for (const auto& patternCol : patternRow) {
-            bool isAlive = patternCol == PTEXT_LIVE;
-            if (isAlive) {
-                ++liveCount;
-            }
-
-            cellRow.emplace_back(col, row, m_width, m_height, isAlive, m_wrapped);
-            ++col;
+        auto rowWidth = std::min(static_cast<int>(patternRow.length()), m_width);
+        for (auto col = 0; col < rowWidth; ++col) {
+            initial.set(col, row, patternRow[col] == PTEXT_LIVE);
         }
-        m_pending.push_back(cellRow);
         ++row;
     }
 
-    std::clog << "Constructed " << m_width << " by " << m_height << " grid, " << liveCount
-              << " live cells, " << m_pending.size() * m_pending[0].size() << " cells overall"
-              << std::endl;
+    // The pattern lives on in the bit grid
+    PatternArray{}.swap(m_patternArray);
+    seedGenerations(initial);
+}
+
+/// \note PRIVATE
+/// Both generations start out as \p initial
+void ConwayGrid::seedGenerations(const BitGrid& initial) {
+    m_choked = BitGrid(m_width, m_height);
+    m_front = 0;
+    m_generations = {initial, initial};
+
+    // Every tile counts as changed, so the first step computes the whole grid
+    m_tilesWide = (m_width + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    m_tilesHigh = (m_height + TILE_ROWS - 1) / TILE_ROWS;
+    m_tileActive.assign(getTileCount(), 0);
+    m_tileChanges.assign(getTileCount(), ~BitWord{0});
+    m_tileRowCounts.assign(m_tilesHigh, {});
+    m_tileRowHashes.assign(m_tilesHigh, 0);
+    m_population = initial.getPopulation();
+    m_stateHash = m_tracksStateHash ? hashCells(initial) : 0;
+
+    std::clog << "Constructed " << m_width << " by " << m_height << " grid, "
+              << m_population << " live cells, "
+              << static_cast<std::size_t>(m_width) * m_height << " cells overall, "
+              << kernelName(m_kernel) << " kernel" << std::endl;
+}
+
+/// \note PRIVATE
+const BitGrid& ConwayGrid::snapshot() const {
+    return m_generations[m_front ^ 1];
+}
+
+/// \note PRIVATE
+/// Steps each run of adjacent active tiles in one span, so the vector kernels keep their width
+void ConwayGrid::stepTileRow(int tileRow) {
+    const auto* active = &m_tileActive[tileRow * m_tilesWide];
+    auto* changes = &m_tileChanges[tileRow * m_tilesWide];
+    std::fill_n(changes, m_tilesWide, 0);
+    TransitionCounts counts;
+
+    KernelSpan span{tileRow * TILE_ROWS, std::min((tileRow + 1) * TILE_ROWS, m_height), 0, 0};
+    for (auto tileCol = 0; tileCol < m_tilesWide;) {
+        if (active[tileCol] == 0) {
+            ++tileCol;
+            continue;
+        }
+
+        span.wordBegin = tileCol;
+        while (tileCol < m_tilesWide && active[tileCol] != 0) {
+            ++tileCol;
+        }
+        span.wordEnd = tileCol;
+
+        stepSpan(
+                snapshot(),
+                m_generations[m_front],
+                m_choked,
+                span,
+                changes,
+                &counts,
+                m_rule,
+                m_kernel);
+    }
+
+    // Written once, so threads on neighboring tile rows do not share the cache line for long
+    m_tileRowCounts[tileRow] = counts;
+    if (!m_tracksStateHash) {
+        return;
+    }
+
+    // Only the words of tiles that changed can have changed the state hash
+    const auto& previous = snapshot();
+    const auto& next = m_generations[m_front];
+    const auto lastWord = next.getWordsPerRow() - 1;
+    std::uint64_t stateHash = 0;
+    for (auto row = span.rowBegin; row < span.rowEnd; ++row) {
+        const auto* before = previous.rowWords(row);
+        const auto* after = next.rowWords(row);
+        for (auto tileCol = 0; tileCol < m_tilesWide; ++tileCol) {
+            if (changes[tileCol] != 0) {
+                const auto mask = tileCol == lastWord ? next.getLastWordMask() : ~BitWord{0};
+                stateHash ^= hashWord(tileCol, row, before[tileCol] & mask)
+                        ^ hashWord(tileCol, row, after[tileCol] & mask);
+            }
+        }
+    }
+    m_tileRowHashes[tileRow] = stateHash;
+}
+
+/// \note PRIVATE
+bool ConwayGrid::wasAlive(int col, int row) const {
+    if (m_unbounded) {
+        return m_sparseGrid.wasAlive(m_viewportLeft + col, m_viewportTop + row);
+    }
+
+    return snapshot().get(col, row);
 }
 }  // namespace gol
\ No newline at end of file
@@ -21,39 +21,135 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 #pragma once
+#include "BitGrid.h"
+#include "Checkpoint.h"
 #include "ConwayCell.h"
 #include "ConwayDefs.h"
+#include "CycleDetector.h"
+#include "GridView.h"
+#include "LifeKernel.h"
+#include "Rule.h"
+#include "SparseGrid.h"
+#include "ThreadPool.h"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace gol {
+/// Rows per tile; a tile is one 64-cell word wide
+constexpr int TILE_ROWS{64};
 
 class ConwayGrid {
 public:
-    ConwayGrid(ScreenSize screenSize, bool wrapped = false);
-    ConwayGrid(PatternArray patternArray, ScreenSize padding, bool wrapped = false);
+    ConwayGrid(
+            ScreenSize screenSize,
+            Topology topology = Topology::BOUNDED,
+            KernelType kernel = KernelType::AUTO);
+    ConwayGrid(ScreenSize screenSize, bool wrapped, KernelType kernel = KernelType::AUTO);
+    ConwayGrid(
+            PatternArray patternArray,
+            ScreenSize padding,
+            Topology topology = Topology::BOUNDED,
+            KernelType kernel = KernelType::AUTO);
+    ConwayGrid(
+            PatternArray patternArray,
+            ScreenSize padding,
+            bool wrapped,
+            KernelType kernel = KernelType::AUTO);
+    ConwayGrid(
+            const BitGrid& cells,
+            ScreenSize padding,
+            Topology topology = Topology::BOUNDED,
+            KernelType kernel = KernelType::AUTO);
+    explicit ConwayGrid(const Checkpoint& checkpoint, KernelType kernel = KernelType::AUTO);
 
     ConwayGrid() = delete;
 
-    CellArray compute();
+    GridView compute();
+    void copyPendingStates(std::uint8_t* states) const;
     void dumpPendingGrid() const;
+    Checkpoint makeCheckpoint() const;
+    void makeUnbounded();
+    void step();
+    void trackStateHash();
 
+    std::size_t getActiveTileCount() const;
+    double getActiveTileRatio() const;
+    std::uint64_t getBirths() const;
+    const BitGrid& getCells() const;
+    std::uint64_t getDeaths() const;
+    std::uint64_t getGeneration() const;
     int getGridHeight() const;
     int getGridWidth() const;
+    KernelType getKernelType() const;
     CellArray getPendingGrid() const;
+    CellPending getPendingState(int col, int row) const;
+    std::uint64_t getPopulation() const;
+    const Rule& getRule() const;
     CellArray getSnapshotGrid() const;
+    std::uint64_t getStateHash() const;
+    GridView getView() const;
+    int getThreadCount() const;
+    std::size_t getTileCount() const;
+    Topology getTopology() const;
+    std::int64_t getViewportLeft() const;
+    std::int64_t getViewportTop() const;
+    bool isAlive(int col, int row) const;
+    bool isStill() const;
+    bool isUnbounded() const;
+    void setRule(const Rule& rule);
+    void setThreadCount(int threadCount);
+    void setViewport(std::int64_t left, std::int64_t top);
+    bool writePatternFile(const std::string& filename) const;
+    bool writeSnapshot(const std::string& prefix) const;
 
 private:
-    void copyPendingToSnapshot();
     void fitGridToWindow();
+    void markActiveTiles();
+    const BitGrid& pending() const;
     void populatePendingGrid();
+    void seedGenerations(const BitGrid& initial);
+    const BitGrid& snapshot() const;
+    void stepTileRow(int tileRow);
+    bool wasAlive(int col, int row) const;
 
     int m_width{10};
     int m_height{10};
     ScreenSize m_padding;
-    bool m_wrapped{false};
+    Topology m_topology{Topology::BOUNDED};
+    BitGrid::HaloFill m_fillHalo{BitGrid::haloFillFor(Topology::BOUNDED)};
+    KernelType m_kernel{KernelType::SCALAR};
+    Rule m_rule;
+    std::shared_ptr<ThreadPool> m_threadPool;
     PatternArray m_patternArray;
-    CellArray m_pending;
-    CellArray m_snapshot;
+    std::array<BitGrid, 2> m_generations;
+    int m_front{0};
+    BitGrid m_choked;
+
+    int m_tilesWide{0};
+    int m_tilesHigh{0};
+    std::vector<std::uint8_t> m_tileActive;
+    std::vector<BitWord> m_tileChanges;
+    std::size_t m_activeTiles{0};
+    std::uint64_t m_generation{0};
+
+    /// Births and deaths of the last step, counted per tile row by whichever thread stepped it
+    std::vector<TransitionCounts> m_tileRowCounts;
+    /// XOR of hashWord() over the words each tile row changed in the last step
+    std::vector<std::uint64_t> m_tileRowHashes;
+    std::uint64_t m_births{0};
+    std::uint64_t m_deaths{0};
+    std::uint64_t m_population{0};
+    bool m_tracksStateHash{false};
+    std::uint64_t m_stateHash{0};
+
+    bool m_unbounded{false};
+    SparseGrid m_sparseGrid;
+    std::int64_t m_viewportLeft{0};
+    std::int64_t m_viewportTop{0};
 };
 }  // namespace gol
\ No newline at end of file
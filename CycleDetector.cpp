@@ -0,0 +1,75 @@
+/// \file CycleDetector.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "CycleDetector.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace gol {
+
+///
+CycleDetector::CycleDetector(std::size_t historyLength)
+    : m_history(std::max<std::size_t>(historyLength, 1)) {
+    m_slots.reserve(m_history.size());
+}
+
+/// Returns the cycle \p generation closes, if it repeats a remembered generation; else
+/// remembers it, forgetting the oldest once the history is full
+std::optional<Cycle> CycleDetector::record(
+        std::uint64_t generation,
+        std::uint64_t stateHash,
+        std::uint64_t population) {
+    auto found = m_slots.find(stateHash);
+    if (found != m_slots.end()) {
+        const auto& earlier = m_history[found->second];
+        if (earlier.population == population) {
+            return Cycle{earlier.generation, generation - earlier.generation};
+        }
+    }
+
+    if (m_size == m_history.size()) {
+        const auto& oldest = m_history[m_next];
+        auto slot = m_slots.find(oldest.stateHash);
+        if (slot != m_slots.end() && slot->second == m_next) {
+            m_slots.erase(slot);
+        }
+    } else {
+        ++m_size;
+    }
+
+    m_history[m_next] = {generation, stateHash, population};
+    m_slots[stateHash] = m_next;
+    m_next = (m_next + 1) % m_history.size();
+
+    return std::nullopt;
+}
+
+///
+void CycleDetector::reset() {
+    m_slots.clear();
+    m_next = 0;
+    m_size = 0;
+}
+}  // namespace gol
@@ -0,0 +1,83 @@
+/// \file CycleDetector.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace gol {
+/// Generations a CycleDetector remembers, and so the longest period it can find
+constexpr std::size_t CYCLE_HISTORY{4096};
+
+/// Hash of one word of cells at word column \p wordCol of \p row; a grid's state hash is the
+/// XOR of those of all its words, so a step need only fold in the words it changed
+/// \note Multiplying by an odd number and folding the high bits down are both invertible, so
+/// each position hashes its 2^64 words to distinct values, and an empty word hashes to zero
+inline std::uint64_t hashWord(std::int64_t wordCol, std::int64_t row, BitWord word) {
+    const auto multiplier = (static_cast<std::uint64_t>(wordCol) * 0x9E3779B97F4A7C15ULL
+                             + static_cast<std::uint64_t>(row) * 0xC2B2AE3D27D4EB4FULL)
+            | 1U;
+    const auto hash = word * multiplier;
+
+    return hash ^ (hash >> 29);
+}
+
+/// A run that repeats: the generation at \p onset recurs every \p period generations
+/// \note A period of 1 is a still life, which includes a grid that has died out
+struct Cycle {
+    std::uint64_t onset{0};
+    std::uint64_t period{0};
+};
+
+/// Finds the first generation that repeats an earlier one, from the state hash and population
+/// of each generation in turn
+/// \note Only the last CYCLE_HISTORY generations are remembered, so longer periods go unnoticed;
+/// a state hash and population that both match are taken as the same generation
+class CycleDetector {
+public:
+    explicit CycleDetector(std::size_t historyLength = CYCLE_HISTORY);
+
+    std::optional<Cycle> record(
+            std::uint64_t generation,
+            std::uint64_t stateHash,
+            std::uint64_t population);
+    void reset();
+
+private:
+    struct Entry {
+        std::uint64_t generation{0};
+        std::uint64_t stateHash{0};
+        std::uint64_t population{0};
+    };
+
+    std::vector<Entry> m_history;
+    std::size_t m_next{0};
+    std::size_t m_size{0};
+    /// Slot in m_history of the newest generation with each state hash
+    std::unordered_map<std::uint64_t, std::size_t> m_slots;
+};
+}  // namespace gol
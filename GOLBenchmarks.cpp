@@ -0,0 +1,265 @@
+/// \file GOLBenchmarks.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "ConwayDefs.h"
+#include "ConwayGrid.h"
+#include "GOLFile.h"
+#include "MooreNeighbor.h"
+#include "ObjectAnalysis.h"
+#include "Soup.h"
+#include "Topology.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace gol;
+
+namespace {
+/// Soups are seeded the same way every run, so results compare across releases
+constexpr std::uint64_t SOUP_SEED{20250101};
+
+/// Part of every cached soup file's name; bump it when makeSoup() or the pattern writers
+/// change what a soup file holds, so earlier files are not parsed in their place
+constexpr int SOUP_FILE_VERSION{2};
+
+/// Patterns this long and wide parse from files of several megabytes
+constexpr int PARSE_SIDES[]{1000, 4000};
+
+/// A half-full \p side by \p side soup, the same every run
+BitGrid makeBenchSoup(int side) {
+    return makeSoup(side, side, {SOUP_SEED});
+}
+
+/// Writes the soup for \p side through \p extension's writer
+/// \note Written into the temporary directory on first use, and reused by later runs
+std::string writeSoupFile(int side, const std::string& extension) {
+    const auto path = std::filesystem::temp_directory_path()
+            / ("gol_bench_v" + std::to_string(SOUP_FILE_VERSION) + "_" + std::to_string(SOUP_SEED)
+               + "_" + std::to_string(side) + "." + extension);
+    if (!std::filesystem::exists(path)) {
+        GOLFile().writePatternFile(path.string(), makeBenchSoup(side), Rule());
+    }
+
+    return path.string();
+}
+
+/// Grid sides for the engine benchmarks, from one tile to a 67M cell board, under each
+/// topology: 0 bounded, 1 torus, 2 Klein bottle, 3 cross-surface
+void gridSizes(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"side", "topology"});
+    for (auto side : {64, 256, 1024, 4096, 8192}) {
+        for (auto topology = 0; topology <= static_cast<int>(Topology::CROSS_SURFACE); ++topology) {
+            bench->Args({side, topology});
+        }
+    }
+    bench->Unit(benchmark::kMicrosecond);
+}
+
+/// Pattern file sides for the parser benchmarks
+void parseSizes(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("side");
+    for (auto side : PARSE_SIDES) {
+        bench->Arg(side);
+    }
+    bench->Unit(benchmark::kMillisecond);
+}
+
+/// Board sides for the writer benchmarks, up to a 16M cell board
+void writeSizes(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("side");
+    for (auto side : {1024, 4096}) {
+        bench->Arg(side);
+    }
+    bench->Unit(benchmark::kMillisecond);
+}
+}  // namespace
+
+/// Bit grid construction from a pattern, including the copy the constructor takes
+static void BM_ConwayGridConstruction(benchmark::State& state) {
+    const auto side = static_cast<int>(state.range(0));
+    const auto soup = toPatternArray(makeBenchSoup(side));
+
+    for (auto _ : state) {
+        ConwayGrid grid(soup, {0, 0}, static_cast<Topology>(state.range(1)));
+        benchmark::DoNotOptimize(grid);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+BENCHMARK(BM_ConwayGridConstruction)->Apply(gridSizes);
+
+/// One generation of a half-full soup; items are cells, so items per second is cell updates
+static void BM_ConwayGridCompute(benchmark::State& state) {
+    const auto side = static_cast<int>(state.range(0));
+    ConwayGrid grid(makeBenchSoup(side), {0, 0}, static_cast<Topology>(state.range(1)));
+
+    for (auto _ : state) {
+        auto view = grid.compute();
+        benchmark::DoNotOptimize(view);
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+    state.counters["active_tiles"] = static_cast<double>(grid.getActiveTileRatio());
+}
+BENCHMARK(BM_ConwayGridCompute)->Apply(gridSizes);
+
+/// Neighborhoods of every cell of a 64x64 grid, edges and corners included
+static void BM_MooreNeighborhood(benchmark::State& state) {
+    constexpr int SIDE{64};
+    const auto topology = static_cast<Topology>(state.range(0));
+
+    for (auto _ : state) {
+        for (auto row = 0; row < SIDE; ++row) {
+            for (auto col = 0; col < SIDE; ++col) {
+                auto neighbors = mooreNeighborhood(col, row, SIDE, SIDE, topology);
+                benchmark::DoNotOptimize(neighbors);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SIDE * SIDE);
+}
+BENCHMARK(BM_MooreNeighborhood)
+        ->ArgName("topology")
+        ->DenseRange(0, static_cast<int>(Topology::CROSS_SURFACE));
+
+///
+static void BM_ParsePlaintext(benchmark::State& state) {
+    const auto filename = writeSoupFile(static_cast<int>(state.range(0)), CELLS);
+
+    for (auto _ : state) {
+        GOLFile patternFile(filename);
+        auto patternArray = patternFile.getPatternArray();
+        benchmark::DoNotOptimize(patternArray);
+    }
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(filename));
+}
+BENCHMARK(BM_ParsePlaintext)->Apply(parseSizes);
+
+///
+static void BM_ParseRLE(benchmark::State& state) {
+    const auto filename = writeSoupFile(static_cast<int>(state.range(0)), RLE);
+
+    for (auto _ : state) {
+        GOLFile patternFile(filename);
+        auto cells = patternFile.getBitGrid();
+        benchmark::DoNotOptimize(cells);
+    }
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(filename));
+}
+BENCHMARK(BM_ParseRLE)->Apply(parseSizes);
+
+/// Seeded soups up to 268M cells, in each symmetry: 0 C1, 1 C2, 2 C4, 3 D8; a density of 30%
+/// takes 8 draws of the generator for each 64 cells rather than one
+static void BM_MakeSoup(benchmark::State& state) {
+    const auto side = static_cast<int>(state.range(0));
+    SoupConfig config;
+    config.symmetry = static_cast<SoupSymmetry>(state.range(1));
+    config.density = state.range(2) / 100.0;
+
+    for (auto _ : state) {
+        auto soup = makeSoup(side, side, config);
+        benchmark::DoNotOptimize(soup);
+        ++config.seed;
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+BENCHMARK(BM_MakeSoup)
+        ->ArgNames({"side", "symmetry", "percent"})
+        ->ArgsProduct({{1024, 16384}, {0, 1, 2, 3}, {50}})
+        ->Args({16384, 0, 30})
+        ->Unit(benchmark::kMillisecond);
+
+/// Separation and naming of the ash a 1024x1024 soup leaves after 2000 generations, with the
+/// classifier's shapes already seen, as they are after the first board of a search
+static void BM_FindObjects(benchmark::State& state) {
+    constexpr int SIDE{1024};
+    constexpr int GENERATIONS{2000};
+    ConwayGrid grid(makeBenchSoup(SIDE), {0, 0});
+    for (auto generation = 0; generation < GENERATIONS; ++generation) {
+        grid.step();
+    }
+
+    ObjectClassifier classifier;
+    std::size_t objects = classifier.findObjects(grid).size();
+    for (auto _ : state) {
+        auto found = classifier.findObjects(grid);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * SIDE * SIDE);
+    state.counters["objects"] = static_cast<double>(objects);
+}
+BENCHMARK(BM_FindObjects)->Unit(benchmark::kMillisecond);
+
+/// Writes a half-full soup through \p extension's writer; bytes are those of the file written
+static void writeSoup(benchmark::State& state, const std::string& extension) {
+    const auto side = static_cast<int>(state.range(0));
+    const auto cells = makeBenchSoup(side);
+    const auto filename = (std::filesystem::temp_directory_path()
+                           / ("gol_bench_write_" + std::to_string(side) + "." + extension))
+                                  .string();
+
+    GOLFile patternFile;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(patternFile.writePatternFile(filename, cells, Rule()));
+    }
+    state.SetBytesProcessed(state.iterations() * std::filesystem::file_size(filename));
+    std::filesystem::remove(filename);
+}
+
+///
+static void BM_WritePlaintext(benchmark::State& state) {
+    writeSoup(state, CELLS);
+}
+BENCHMARK(BM_WritePlaintext)->Apply(writeSizes);
+
+///
+static void BM_WriteRLE(benchmark::State& state) {
+    writeSoup(state, RLE);
+}
+BENCHMARK(BM_WriteRLE)->Apply(writeSizes);
+
+/// Reports are JSON unless another format is asked for, so runs can be diffed across releases
+int main(int argc, char** argv) {
+    std::vector<char*> args(argv, argv + argc);
+    std::string jsonFormat{"--benchmark_format=json"};
+    bool formatGiven = false;
+    for (auto* arg : args) {
+        formatGiven = formatGiven || std::string(arg).starts_with("--benchmark_format");
+    }
+    if (!formatGiven) {
+        args.push_back(jsonFormat.data());
+    }
+
+    auto numArgs = static_cast<int>(args.size());
+    benchmark::Initialize(&numArgs, args.data());
+    if (benchmark::ReportUnrecognizedArguments(numArgs, args.data())) {
+        return EXIT_FAILURE;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return EXIT_SUCCESS;
+}
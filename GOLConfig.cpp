@@ -60,6 +60,9 @@ GOLConfig::GOLConfig() {
     readDisplayParams();
     readLifeTick();
     readStartupDelay();
+    readHashLifeMemory();
+    readThreadCount();
+    readGenerationsPerTick();
 }
 
 /// \note PRIVATE
@@ -115,6 +118,36 @@ void GOLConfig::readDisplayParams() {
     computeScreenTiling();
 }
 
+/// \note PRIVATE
+/// Optional; each life tick advances this many generations
+void GOLConfig::readGenerationsPerTick() {
+    if (!m_json.contains("generationsPerTick")) {
+        return;
+    }
+
+    auto inValue = m_json["generationsPerTick"];
+    std::stringstream ss;
+    ss << inValue.get<std::string>();
+
+    ss >> m_generationsPerTick;
+    std::clog << "Generations per tick " << m_generationsPerTick << std::endl;
+}
+
+/// \note PRIVATE
+/// Optional, so that config files predating HashLife still load
+void GOLConfig::readHashLifeMemory() {
+    if (!m_json.contains("hashLifeMemoryMB")) {
+        return;
+    }
+
+    auto inValue = m_json["hashLifeMemoryMB"];
+    std::stringstream ss;
+    ss << inValue.get<std::string>();
+
+    ss >> m_hashLifeMemoryMB;
+    std::clog << "HashLife memory cap " << m_hashLifeMemoryMB << " MB" << std::endl;
+}
+
 /// \note PRIVATE
 void GOLConfig::readLifeTick() {
     auto inValue = m_json["lifeTickInSecs"];
@@ -153,4 +186,19 @@ void GOLConfig::readStateColors() {
     m_cellColors[CELL_REBORN] = m_colorReborn;
 }
 
+/// \note PRIVATE
+/// Optional; zero asks for one stepping thread per hardware thread
+void GOLConfig::readThreadCount() {
+    if (!m_json.contains("threadCount")) {
+        return;
+    }
+
+    auto inValue = m_json["threadCount"];
+    std::stringstream ss;
+    ss << inValue.get<std::string>();
+
+    ss >> m_threadCount;
+    std::clog << "Thread count " << m_threadCount << std::endl;
+}
+
 }  // namespace gol
@@ -22,9 +22,11 @@
 // SOFTWARE.
 #pragma once
 #include "ConwayDefs.h"
+#include "HashLife.h"
 
 #include <nlohmann/json.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <unordered_map>
@@ -48,6 +50,8 @@ static constexpr ScreenSize GOL_TILING_720P{
 
 static constexpr float GOL_LIFE_TICK(0.5);
 static constexpr float GOL_STARTUP_DELAY(3.0);
+static constexpr int GOL_THREAD_COUNT{1};
+static constexpr int GOL_GENERATIONS_PER_TICK{1};
 
 ///
 class GOLConfig {
@@ -59,6 +63,14 @@ public:
         return m_cellColors[cellPending];
     }
 
+    int getGenerationsPerTick() const {
+        return m_generationsPerTick;
+    }
+
+    std::size_t getHashLifeMemory() const {
+        return m_hashLifeMemoryMB << 20;
+    }
+
     float getLifeTick() const {
         return m_lifeTick;
     }
@@ -75,6 +87,10 @@ public:
         return m_startupDelay;
     }
 
+    int getThreadCount() const {
+        return m_threadCount;
+    }
+
     float getTileSize() const {
         return m_tileSize;
     }
@@ -87,6 +103,14 @@ public:
         m_classicMode = classic;
     }
 
+    bool isVerbose() const {
+        return m_verbose;
+    }
+
+    void setVerbose(bool verbose) {
+        m_verbose = verbose;
+    }
+
     void setTileSize(float tileSize) {
         m_tileSize = tileSize;
         computeScreenTiling();
@@ -98,9 +122,12 @@ private:
     std::uint32_t convertStateColor(const char* jsonKey);
     float convertTileSize(const char* jsonKey);
     void readDisplayParams();
+    void readGenerationsPerTick();
+    void readHashLifeMemory();
     void readLifeTick();
     void readStartupDelay();
     void readStateColors();
+    void readThreadCount();
 
     json m_json;
 
@@ -122,6 +149,10 @@ private:
     ScreenSize m_screenTiling{GOL_TILING_720P};
     float m_lifeTick{GOL_LIFE_TICK};
     float m_startupDelay{GOL_STARTUP_DELAY};
+    std::size_t m_hashLifeMemoryMB{HASHLIFE_MEMORY_MB};
+    int m_threadCount{GOL_THREAD_COUNT};
+    int m_generationsPerTick{GOL_GENERATIONS_PER_TICK};
     bool m_classicMode{false};
+    bool m_verbose{false};
 };
 }  // namespace gol
\ No newline at end of file
@@ -23,20 +23,217 @@
 #include "GOLFile.h"
 
 #include "ConwayDefs.h"
+#include "HashLife.h"
+#include "MappedFile.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cctype>
+#include <charconv>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
-#include <iterator>
 #include <limits>
-#include <sstream>
 #include <string>
+#include <string_view>
 
 namespace gol {
+namespace {
+/// Longest run read from an RLE count; longer runs overrun any grid and are clipped anyway
+constexpr std::int64_t MAX_RUN_LENGTH{std::int64_t{1} << 40};
+
+/// Bytes a writer buffers before handing them to its stream
+constexpr std::size_t WRITE_BUFFER_BYTES{std::size_t{1} << 20};
+
+/// Plaintext for each byte of a row word, lowest bit, and so leftmost cell, first
+constexpr auto PLAINTEXT_BYTES = [] {
+    std::array<std::array<char, 8>, 256> bytes{};
+    for (auto byte = 0; byte < 256; ++byte) {
+        for (auto bit = 0; bit < 8; ++bit) {
+            bytes[byte][bit] = ((byte >> bit) & 1) != 0 ? PTEXT_LIVE : PTEXT_DEAD;
+        }
+    }
+    return bytes;
+}();
+
+/// Column of the first live cell, or dead cell when \p alive is false, from \p col on; the
+/// width of the row if there is none
+/// \note Whole words of the other kind are stepped over in one test each
+int findCell(const BitWord* words, int col, int width, bool alive) {
+    const auto flip = alive ? BitWord{0} : ~BitWord{0};
+    const auto lastWord = width / BITS_PER_WORD;
+    auto index = col / BITS_PER_WORD;
+    auto word = (words[index] ^ flip) & (~BitWord{0} << (col % BITS_PER_WORD));
+    while (word == 0) {
+        if (++index > lastWord) {
+            return width;
+        }
+        word = words[index] ^ flip;
+    }
+
+    return std::min(index * BITS_PER_WORD + std::countr_zero(word), width);
+}
+
+/// Hands \p buffer to \p out once it holds at least \p threshold bytes
+void drainBuffer(std::ofstream& out, std::string& buffer, std::size_t threshold) {
+    if (buffer.size() >= threshold) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+}
+
+/// Turns runs of cells and row ends into RLE tokens, wrapping lines at RLE_LINE_LENGTH
+/// \note Row ends are held back until the next run, so empty rows come out as a single token
+/// and the empty rows at the end of a pattern never come out at all
+class RLEEncoder {
+public:
+    explicit RLEEncoder(std::ofstream& out)
+        : m_out(out) {
+        m_buffer.reserve(WRITE_BUFFER_BYTES);
+    }
+
+    /// \note Callers pass whole runs, so like runs never follow one another within a row
+    void addRun(int count, char tag) {
+        if (m_rowEnds > 0) {
+            emit(m_rowEnds, RLE_EOL);
+            m_rowEnds = 0;
+        }
+        emit(count, tag);
+    }
+
+    void endRow() {
+        ++m_rowEnds;
+        drainBuffer(m_out, m_buffer, WRITE_BUFFER_BYTES);
+    }
+
+    void finish() {
+        emit(1, RLE_EOD);
+        m_buffer += '\n';
+        drainBuffer(m_out, m_buffer, 0);
+    }
+
+private:
+    void emit(std::int64_t count, char tag) {
+        char token[24];
+        auto* end = token;
+        if (count > 1) {
+            end = std::to_chars(token, token + sizeof(token) - 1, count).ptr;
+        }
+        *end++ = tag;
+
+        const auto length = static_cast<int>(end - token);
+        if (m_lineLength + length > RLE_LINE_LENGTH) {
+            m_buffer += '\n';
+            m_lineLength = 0;
+        }
+        m_buffer.append(token, length);
+        m_lineLength += length;
+    }
+
+    std::ofstream& m_out;
+    std::string m_buffer;
+    std::int64_t m_rowEnds{0};
+    int m_lineLength{0};
+};
+
+/// Logs how long writing \p filename took, or why it failed
+bool reportWritten(
+        std::ofstream& out,
+        const std::string& filename,
+        std::chrono::steady_clock::time_point start) {
+    out.close();
+    if (!out) {
+        std::cerr << "Couldn't write pattern file " << filename << std::endl;
+        return false;
+    }
+
+    const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+    std::clog << "Wrote " << filename << " in " << elapsed.count() << " ms" << std::endl;
+    return true;
+}
+
+/// False, with the reason on std::cerr, unless \p filename names a non-empty regular file
+bool isPatternFile(const std::string& filename) {
+    namespace fs = std::filesystem;
+
+    // Check file exists before attempting to open
+    if (!fs::exists(filename)) {
+        std::cerr << "Pattern file does not exist: " << filename << std::endl;
+        return false;
+    }
+
+    // Check it's a regular file
+    if (!fs::is_regular_file(filename)) {
+        std::cerr << "Path is not a regular file: " << filename << std::endl;
+        return false;
+    }
+
+    // Check file size
+    if (fs::file_size(filename) == 0) {
+        std::cerr << "Pattern file is empty: " << filename << std::endl;
+        return false;
+    }
+
+    return true;
+}
+}  // namespace
+
+/// Crops \p window of the plane into a grid; nothing if the window is too large for one
+std::optional<BitGrid> cropToBitGrid(const HashLife& hashLife, const PlaneRect& window) {
+    constexpr std::int64_t maxSide{std::numeric_limits<int>::max() - BITS_PER_WORD};
+    if (window.width > maxSide || window.height > maxSide
+        || static_cast<std::uint64_t>(window.width) * static_cast<std::uint64_t>(window.height)
+                   > MAX_RLE_CELLS) {
+        std::cerr << "Pattern of " << window.width << " x " << window.height
+                  << " cells is too large for a grid of " << MAX_RLE_CELLS << " cells" << std::endl;
+        return std::nullopt;
+    }
+
+    return hashLife.getBitGrid(window);
+}
+
+/// \note Rows shorter than the first are taken to end in dead cells
+BitGrid toBitGrid(const PatternArray& patternArray) {
+    const auto height = static_cast<int>(patternArray.size());
+    const auto width = patternArray.empty() ? 0 : static_cast<int>(patternArray[0].length());
+    BitGrid cells(width, height);
+
+    for (auto row = 0; row < height; ++row) {
+        const auto& patternRow = patternArray[row];
+        const auto rowWidth = std::min(static_cast<int>(patternRow.length()), width);
+        for (auto col = 0; col < rowWidth; ++col) {
+            if (patternRow[col] == PTEXT_LIVE) {
+                cells.set(col, row, true);
+            }
+        }
+    }
+
+    return cells;
+}
+
+///
+PatternArray toPatternArray(const BitGrid& cells) {
+    PatternArray patternArray;
+    patternArray.reserve(cells.getHeight());
+
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        std::string patternRow(cells.getWidth(), PTEXT_DEAD);
+        for (auto col = 0; col < cells.getWidth(); ++col) {
+            if (cells.get(col, row)) {
+                patternRow[col] = PTEXT_LIVE;
+            }
+        }
+        patternArray.push_back(std::move(patternRow));
+    }
+
+    return patternArray;
+}
 
 ///
 GOLFile::GOLFile(const char* filename)
@@ -48,6 +245,29 @@ GOLFile::GOLFile(const std::string& filename)
     : m_filename(filename)
     , m_extension(getExtension(filename)) {}
 
+/// \note RLE files are decoded straight into the bit grid; plaintext goes by way of its rows.
+/// Macrocell files go by way of HashLife, cropped to their live cells.
+std::optional<BitGrid> GOLFile::getBitGrid() {
+    m_rule.reset();
+    if (m_extension == MACROCELL) {
+        HashLife hashLife;
+        if (!readMacrocell(hashLife)) {
+            return std::nullopt;
+        }
+        return cropToBitGrid(hashLife, hashLife.getBounds().value_or(PlaneRect{0, 0, 1, 1}));
+    }
+
+    if (m_extension == CELLS) {
+        auto patternArray = readPlaintextPatternFile(m_filename);
+        if (patternArray.empty()) {
+            return std::nullopt;
+        }
+        return toBitGrid(patternArray);
+    }
+
+    return readRLEBitGrid(m_filename);
+}
+
 ///
 std::string GOLFile::getFilename() const {
     return m_filename;
@@ -55,6 +275,12 @@ std::string GOLFile::getFilename() const {
 
 ///
 PatternArray GOLFile::getPatternArray() {
+    m_rule.reset();
+    if (m_extension == MACROCELL) {
+        auto cells = getBitGrid();
+        return cells.has_value() ? toPatternArray(cells.value()) : PatternArray{};
+    }
+
     if (m_extension == CELLS) {
         return readPlaintextPatternFile(m_filename);
     } else {
@@ -62,6 +288,84 @@ PatternArray GOLFile::getPatternArray() {
     }
 }
 
+/// \note The rule named by the last RLE or Macrocell file read, if it named one this engine
+/// supports
+std::optional<Rule> GOLFile::getRule() const {
+    return m_rule;
+}
+
+///
+bool GOLFile::isMacrocell() const {
+    return m_extension == MACROCELL;
+}
+
+/// Reads the Macrocell file straight into the quadtree of \p hashLife, under the rule and at
+/// the generation its header names
+/// \note The file is mapped rather than read, and the plane is never expanded into a grid
+/// \see https://conwaylife.com/wiki/Macrocell
+bool GOLFile::readMacrocell(HashLife& hashLife) {
+    m_rule.reset();
+    if (!isPatternFile(m_filename)) {
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    MappedFile file(m_filename);
+    if (!file.isOpen()) {
+        return false;
+    }
+
+    const auto text = file.view();
+    if (!text.starts_with(MC_HEADER)) {
+        std::cerr << "No " << MC_HEADER << " header in " << m_filename << std::endl;
+        return false;
+    }
+
+    // The rule and generation come in "#R" and "#G" lines ahead of the nodes
+    std::uint64_t generation{0};
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        const auto eol = std::min(text.find('\n', pos), text.size());
+        const auto line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        if (line.empty() || line[0] == MC_HEADER[0]) {
+            continue;
+        }
+        if (line[0] != MC_DELIM || line.size() < 2) {
+            break;
+        }
+
+        if (line[1] == 'R') {
+            m_rule = Rule::parse(std::string(line.substr(2)));
+            if (!m_rule.has_value()) {
+                std::clog << "Ignoring the rule of " << m_filename << std::endl;
+            }
+        } else if (line[1] == 'G') {
+            const auto digits = std::min(line.find_first_not_of(" \t", 2), line.size());
+            std::from_chars(line.data() + digits, line.data() + line.size(), generation);
+        }
+    }
+
+    if (!hashLife.loadMacrocell(text)) {
+        std::cerr << "Couldn't read Macrocell file " << m_filename << std::endl;
+        return false;
+    }
+
+    if (m_rule.has_value()) {
+        hashLife.setRule(m_rule.value());
+    }
+    hashLife.setGeneration(generation);
+
+    const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+    std::clog << "Parsed " << text.size() << " bytes of " << m_filename << " in "
+              << elapsed.count() << " ms, " << hashLife.getPopulation() << " live cells, "
+              << hashLife.getNodeCount() << " nodes" << std::endl;
+
+    return true;
+}
+
 ///
 PatternArray GOLFile::readPatternFile(const char* filename) {
     m_filename = filename;
@@ -78,6 +382,49 @@ PatternArray GOLFile::readPatternFile(const std::string& filename) {
     return getPatternArray();
 }
 
+/// Writes the plane of \p hashLife as a Macrocell file, under its rule and at its generation
+/// \note Shared subtrees are written once, so the file grows with the plane's distinct nodes
+bool GOLFile::writeMacrocellFile(const std::string& filename, const HashLife& hashLife) {
+    m_filename = filename;
+    m_extension = getExtension(m_filename);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) {
+        std::cerr << "Couldn't open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    out << MC_HEADER << " (game_of_life)\n"
+        << MC_DELIM << "R " << hashLife.getRule().getName() << '\n'
+        << MC_DELIM << "G " << hashLife.getGeneration() << '\n';
+    hashLife.saveMacrocell(out);
+
+    return reportWritten(out, filename, start);
+}
+
+/// Writes \p cells as plaintext if \p filename ends in .cells, as Macrocell if it ends in .mc,
+/// else as RLE under \p rule
+/// \note Works straight from the bit grid, a word at a time, with no PatternArray between
+bool GOLFile::writePatternFile(
+        const std::string& filename,
+        const BitGrid& cells,
+        const Rule& rule) {
+    m_filename = filename;
+    m_extension = getExtension(m_filename);
+
+    if (m_extension == MACROCELL) {
+        HashLife hashLife(cells);
+        hashLife.setRule(rule);
+        return writeMacrocellFile(m_filename, hashLife);
+    }
+
+    if (m_extension == CELLS) {
+        return writePlaintextPatternFile(m_filename, cells);
+    }
+    return writeRLEPatternFile(m_filename, cells, rule);
+}
+
 /// \note PRIVATE
 std::string GOLFile::getExtension(const std::string& patternFileName) {
     namespace fs = std::filesystem;
@@ -114,24 +461,7 @@ std::size_t GOLFile::prescanPlaintext(std::ifstream& pattern) {
 /// \note PRIVATE
 /// \see https://conwaylife.com/wiki/Plaintext
 PatternArray GOLFile::readPlaintextPatternFile(const std::string& filename) {
-    namespace fs = std::filesystem;
-
-    // Check file exists before attempting to open
-    if (!fs::exists(filename)) {
-        std::cerr << "Pattern file does not exist: " << filename << std::endl;
-        return {};
-    }
-
-    // Check it's a regular file
-    if (!fs::is_regular_file(filename)) {
-        std::cerr << "Path is not a regular file: " << filename << std::endl;
-        return {};
-    }
-
-    // Check file size
-    auto fileSize = fs::file_size(filename);
-    if (fileSize == 0) {
-        std::cerr << "Pattern file is empty: " << filename << std::endl;
+    if (!isPatternFile(filename)) {
         return {};
     }
 
@@ -168,149 +498,216 @@ PatternArray GOLFile::readPlaintextPatternFile(const std::string& filename) {
 }
 
 /// \note PRIVATE
+/// Decodes runs straight from the mapped file into the bit grid: nothing is copied, and a run
+/// of live cells is set a word at a time
+/// \note Whitespace is skipped between tokens rather than stripped beforehand, so a run count
+/// may still straddle a line break; anything after '!' is never read. Cells past the width or
+/// height given in the header are dropped.
 /// \see https://conwaylife.com/wiki/Run_Length_Encoded
-PatternArray GOLFile::readRLEPatternFile(const std::string& filename) {
-    namespace fs = std::filesystem;
-
-    // Check file exists before attempting to open
-    if (!fs::exists(filename)) {
-        std::cerr << "Pattern file does not exist: " << filename << std::endl;
-        return {};
+std::optional<BitGrid> GOLFile::readRLEBitGrid(const std::string& filename) {
+    if (!isPatternFile(filename)) {
+        return std::nullopt;
     }
 
-    // Check it's a regular file
-    if (!fs::is_regular_file(filename)) {
-        std::cerr << "Path is not a regular file: " << filename << std::endl;
-        return {};
+    const auto start = std::chrono::steady_clock::now();
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        return std::nullopt;
     }
 
-    // Check file size
-    auto fileSize = fs::file_size(filename);
-    if (fileSize == 0) {
-        std::cerr << "Pattern file is empty: " << filename << std::endl;
-        return {};
-    }
+    const auto text = file.view();
+    std::size_t pos = 0;
+    auto gridW{0};
+    auto gridH{0};
+    while (pos < text.size()) {
+        const auto eol = std::min(text.find('\n', pos), text.size());
+        const auto line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        // Comment lines, and anything else, ahead of the header are skipped
+        if (line.empty() || line[0] != RLE_HEADER) {
+            continue;
+        }
 
-    std::ifstream pattern(filename);
-    if (pattern) {
-        PatternArray grid;
-        std::string line;
-        auto gridW{0};
-        auto gridH{0};
-        while (std::getline(pattern, line)) {
-            if (line[0] == RLE_DELIM) {
-                continue;
-            }
+        // Use a fixed-size buffer for the rule string
+        const std::string header(line);
+        char ruleBuffer[256] = {0};
+        std::sscanf(header.c_str(), "x = %d, y = %d, rule = %255s", &gridW, &gridH, ruleBuffer);
 
-            if (line[0] == RLE_HEADER) {
-                // Use a fixed-size buffer for the rule string
-                char ruleBuffer[256] = {0};
-                std::sscanf(line.c_str(), "x = %d, y = %d, rule = %s", &gridW, &gridH, ruleBuffer);
-
-                // Validate dimensions
-                if (gridW <= 0 || gridH <= 0 || gridW > 10000 || gridH > 10000) {
-                    std::cerr << "Invalid RLE dimensions: x=" << gridW << " y=" << gridH
-                              << std::endl;
-                    return {};
-                }
-                break;
+        if (ruleBuffer[0] != '\0') {
+            m_rule = Rule::parse(ruleBuffer);
+            if (!m_rule.has_value()) {
+                std::clog << "Ignoring the rule of " << filename << std::endl;
             }
         }
+        break;
+    }
 
-        // Verify we found a valid header
-        if (gridW <= 0 || gridH <= 0) {
-            std::cerr << "Failed to parse RLE header or invalid dimensions" << std::endl;
-            return {};
-        }
+    if (gridW <= 0 || gridH <= 0) {
+        std::cerr << "Failed to parse RLE header or invalid dimensions" << std::endl;
+        return std::nullopt;
+    }
 
-        std::string commands(std::istreambuf_iterator<char>{pattern}, {});
-        if (!commands.empty()) {
-            commands.erase(
-                    std::remove_if(commands.begin(), commands.end(), ::isspace), commands.end());
+    if (static_cast<std::uint64_t>(gridW) * static_cast<std::uint64_t>(gridH) > MAX_RLE_CELLS) {
+        std::cerr << "Invalid RLE dimensions: x=" << gridW << " y=" << gridH << " exceeds "
+                  << MAX_RLE_CELLS << " cells" << std::endl;
+        return std::nullopt;
+    }
+
+    BitGrid cells(gridW, gridH);
+    std::int64_t count{0};
+    bool counted = false;
+    auto col{0};
+    auto row{0};
+    bool ended = false;
+    for (; pos < text.size() && !ended; ++pos) {
+        const auto command = text[pos];
+        if (command >= '0' && command <= '9') {
+            count = std::min(count * 10 + (command - '0'), MAX_RUN_LENGTH);
+            counted = true;
+            continue;
         }
 
-        // Remove everything after '!' (end of data marker) to exclude comments
-        auto eodPos = commands.find('!');
-        if (eodPos != std::string::npos) {
-            commands = commands.substr(0, eodPos + 1);  // Keep the '!' character
+        const auto run = counted ? count : 1;
+        switch (command) {
+        // A run count may straddle a line break
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\v':
+        case '\f':
+        case '\r':
+            continue;
+        case RLE_LIVE:
+        // LifeHistory states - treat all as alive for standard Conway's Life
+        case 'A':
+        case 'B':
+        case 'C':
+        case 'D':
+        case 'E':
+        case 'F':
+            if (row < gridH && col < gridW) {
+                cells.setRun(col, row, static_cast<int>(std::min<std::int64_t>(run, gridW - col)));
+            }
+            col = static_cast<int>(std::min<std::int64_t>(col + run, gridW));
+            break;
+        case RLE_DEAD:
+        case '.':  // Explicit dead cell (used in LifeHistory)
+            col = static_cast<int>(std::min<std::int64_t>(col + run, gridW));
+            break;
+        case RLE_EOL:
+            row = static_cast<int>(std::min<std::int64_t>(row + run, gridH));
+            col = 0;
+            break;
+        case RLE_EOD:
+            ended = true;
+            break;
+        default:
+            break;
         }
 
-        // Check if we actually got RLE data
-        if (commands.empty()) {
-            std::cerr << "No RLE data found after header" << std::endl;
-            return {};
+        count = 0;
+        counted = false;
+    }
+
+    if (!ended) {
+        std::cerr << "No end of RLE data found in " << filename << std::endl;
+        return std::nullopt;
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const auto megabytes = static_cast<double>(text.size()) / 1.0e6;
+    std::clog << "Parsed " << text.size() << " bytes of " << filename << " in "
+              << elapsed.count() * 1000.0 << " ms, "
+              << (elapsed.count() > 0.0 ? megabytes / elapsed.count() : 0.0) << " MB/s"
+              << std::endl;
+
+    return cells;
+}
+
+/// \note PRIVATE
+PatternArray GOLFile::readRLEPatternFile(const std::string& filename) {
+    auto cells = readRLEBitGrid(filename);
+    return cells.has_value() ? toPatternArray(cells.value()) : PatternArray{};
+}
+
+/// \note PRIVATE
+/// Every row is written out to the full width, so the pattern reads back at the same size
+/// \see https://conwaylife.com/wiki/Plaintext
+bool GOLFile::writePlaintextPatternFile(const std::string& filename, const BitGrid& cells) {
+    const auto start = std::chrono::steady_clock::now();
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) {
+        std::cerr << "Couldn't open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    std::string buffer;
+    buffer += PTEXT_DELIM;
+    buffer += "Name: " + std::filesystem::path(filename).stem().string() + "\n";
+
+    const auto width = cells.getWidth();
+    std::string rowText(static_cast<std::size_t>(cells.getWordsPerRow()) * BITS_PER_WORD, '\0');
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        const auto* words = cells.rowWords(row);
+        auto* text = rowText.data();
+        for (auto i = 0; i * BITS_PER_WORD < width; ++i) {
+            for (auto byte = 0; byte < 8; ++byte) {
+                const auto& chars = PLAINTEXT_BYTES[(words[i] >> (8 * byte)) & 0xFFU];
+                std::copy(chars.begin(), chars.end(), text);
+                text += chars.size();
+            }
         }
 
-        std::stringstream ss;
-        std::string cmdString;
-        std::string blancLine(gridW, PTEXT_DEAD);
-        for (const auto& command : commands) {
-            if (std::isdigit(command)) {
-                ss << command;
-            } else {
-                int count = 1;
-                if (ss.rdbuf()->in_avail() != 0) {
-                    ss >> count;
-                    ss.str({});
-                    ss.clear();
-                }
-
-                switch (command) {
-                case RLE_DEAD:
-                    cmdString.append(count, PTEXT_DEAD);
-                    break;
-                case RLE_LIVE:
-                    cmdString.append(count, PTEXT_LIVE);
-                    break;
-                // LifeHistory states - treat all as alive for standard Conway's Life
-                case 'A':
-                case 'B':
-                case 'C':
-                case 'D':
-                case 'E':
-                case 'F':
-                    cmdString.append(count, PTEXT_LIVE);
-                    break;
-                case '.':  // Explicit dead cell (used in LifeHistory)
-                    cmdString.append(count, PTEXT_DEAD);
-                    break;
-                case RLE_EOL:
-                    // Pad or truncate to exact width
-                    if (cmdString.length() < static_cast<std::size_t>(gridW)) {
-                        cmdString.append(gridW - cmdString.length(), PTEXT_DEAD);
-                    } else if (cmdString.length() > static_cast<std::size_t>(gridW)) {
-                        cmdString = cmdString.substr(0, gridW);
-                    }
-                    grid.push_back(cmdString);
-                    cmdString = {};
-
-                    if (count > 1) {
-                        for (auto i = 0; i < count - 1; ++i) {
-                            grid.push_back(blancLine);
-                        }
-                    }
-                    break;
-                case RLE_EOD:
-                    // Pad or truncate to exact width
-                    if (cmdString.length() < static_cast<std::size_t>(gridW)) {
-                        cmdString.append(gridW - cmdString.length(), PTEXT_DEAD);
-                    } else if (cmdString.length() > static_cast<std::size_t>(gridW)) {
-                        cmdString = cmdString.substr(0, gridW);
-                    }
-                    grid.push_back(cmdString);
-
-                    if (grid.size() < static_cast<std::size_t>(gridH)) {
-                        std::size_t missingRows = gridH - grid.size();
-                        for (std::size_t i = 0; i < missingRows; ++i) {
-                            grid.push_back(blancLine);
-                        }
-                    }
-                    return grid;
-                }
+        buffer.append(rowText, 0, width);
+        buffer += '\n';
+        drainBuffer(out, buffer, WRITE_BUFFER_BYTES);
+    }
+    drainBuffer(out, buffer, 0);
+
+    return reportWritten(out, filename, start);
+}
+
+/// \note PRIVATE
+/// Each row is walked from one change of state to the next with a count of trailing zeros, so
+/// long runs cost a word at a time
+/// \see https://conwaylife.com/wiki/Run_Length_Encoded
+bool GOLFile::writeRLEPatternFile(
+        const std::string& filename,
+        const BitGrid& cells,
+        const Rule& rule) {
+    const auto start = std::chrono::steady_clock::now();
+    std::ofstream out(filename, std::ios::binary);
+    if (!out) {
+        std::cerr << "Couldn't open " << filename << " for writing" << std::endl;
+        return false;
+    }
+
+    const auto width = cells.getWidth();
+    out << RLE_HEADER << " = " << width << ", y = " << cells.getHeight()
+        << ", rule = " << rule.getName() << '\n';
+
+    RLEEncoder encoder(out);
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        const auto* words = cells.rowWords(row);
+        auto col = 0;
+        while (col < width) {
+            const auto live = findCell(words, col, width, true);
+            if (live == width) {
+                break;
             }
+            const auto dead = findCell(words, live, width, false);
+
+            if (live > col) {
+                encoder.addRun(live - col, RLE_DEAD);
+            }
+            encoder.addRun(dead - live, RLE_LIVE);
+            col = dead;
         }
+        encoder.endRow();
     }
+    encoder.finish();
 
-    return {};
+    return reportWritten(out, filename, start);
 }
 }  // namespace gol
@@ -21,8 +21,12 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 #pragma once
+#include "BitGrid.h"
 #include "ConwayDefs.h"
+#include "Rule.h"
 
+#include <cstdint>
+#include <optional>
 #include <string>
 
 namespace gol {
@@ -41,26 +45,62 @@ constexpr char RLE_HEADER{'x'};
 constexpr char RLE_EOL{'$'};
 constexpr char RLE_EOD{'!'};
 
+constexpr char MACROCELL[]{"mc"};
+constexpr char MC_HEADER[]{"[M2]"};
+constexpr char MC_LIVE{'*'};
+constexpr char MC_DEAD{'.'};
+constexpr char MC_DELIM{'#'};
+constexpr char MC_EOL{'$'};
+
+/// Level of a Macrocell leaf, which spells out 8x8 cells
+constexpr int MC_LEAF_LEVEL{3};
+constexpr int MC_LEAF_SIZE{1 << MC_LEAF_LEVEL};
+
+/// Longest line an RLE writer emits, as the format asks
+constexpr int RLE_LINE_LENGTH{70};
+
+/// Largest RLE pattern read, or stretch of a Macrocell plane cropped, in cells; at one bit per
+/// cell, 2 GiB of grid
+constexpr std::uint64_t MAX_RLE_CELLS{std::uint64_t{1} << 34};
+
+class HashLife;
+struct PlaneRect;
+
+std::optional<BitGrid> cropToBitGrid(const HashLife& hashLife, const PlaneRect& window);
+BitGrid toBitGrid(const PatternArray& patternArray);
+PatternArray toPatternArray(const BitGrid& cells);
+
 class GOLFile {
 public:
     GOLFile() = default;
     GOLFile(const char* filename);
     GOLFile(const std::string& filename);
 
+    std::optional<BitGrid> getBitGrid();
     std::string getFilename() const;
     PatternArray getPatternArray();
+    std::optional<Rule> getRule() const;
+    bool isMacrocell() const;
+
+    bool readMacrocell(HashLife& hashLife);
 
     PatternArray readPatternFile(const char* filename);
     PatternArray readPatternFile(const std::string& filename);
+    bool writeMacrocellFile(const std::string& filename, const HashLife& hashLife);
+    bool writePatternFile(const std::string& filename, const BitGrid& cells, const Rule& rule);
 
 private:
     std::size_t prescanPlaintext(std::ifstream& pattern);
     std::string getExtension(const std::string& filename);
     PatternArray readPlaintextPatternFile(const std::string& filename);
+    std::optional<BitGrid> readRLEBitGrid(const std::string& filename);
     PatternArray readRLEPatternFile(const std::string& filename);
+    bool writePlaintextPatternFile(const std::string& filename, const BitGrid& cells);
+    bool writeRLEPatternFile(const std::string& filename, const BitGrid& cells, const Rule& rule);
 
     std::string m_filename;
     std::string m_extension{CELLS};
+    std::optional<Rule> m_rule;
 };
 
 }  // namespace gol
\ No newline at end of file
@@ -20,16 +20,37 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+#include "Census.h"
+#include "Checkpoint.h"
 #include "ConwayCell.h"
 #include "ConwayGrid.h"
 #include "GOLConfig.h"
 #include "GOLFile.h"
+#include "HashLife.h"
+#include "Headless.h"
+#include "LifeKernel.h"
 #include "MooreNeighbor.h"
+#include "ObjectAnalysis.h"
+#include "Rule.h"
+#include "Simulation.h"
+#include "Soup.h"
+#include "SparseGrid.h"
+#include "Telemetry.h"
+#include "ThreadPool.h"
+#include "TickScheduler.h"
+#include "Topology.h"
+#include "TripleBuffer.h"
 #include "TestConfig.h"
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
 
 using namespace gol;
 
@@ -51,6 +72,12 @@ struct GOLTests : public ::testing::Test {
     static constexpr int H2x2{2};
     static constexpr int W3x2{2};
     static constexpr int H3x2{3};
+
+    /// A \p width by \p height soup drawn from \p seed, each cell alive with \p density
+    static PatternArray makeSoupPattern(
+            std::uint64_t seed, int width, int height, double density = SOUP_DENSITY) {
+        return toPatternArray(makeSoup(width, height, {seed, density}));
+    }
 };
 
 ///
@@ -106,12 +133,256 @@ TEST_F(GOLTests, NeighborhoodOfEdgeCellsShouldBeComputedProperly) {
     EXPECT_EQ(lr.getNumNeighbors(), 3);
 }
 
+/// Neighbors found in place agree with the listed Moore neighborhood under every topology,
+/// on grids down to a cell across
+TEST_F(GOLTests, ImplicitNeighborsShouldMatchMooreNeighborhood) {
+    for (auto topology :
+         {Topology::BOUNDED, Topology::TORUS, Topology::KLEIN_BOTTLE, Topology::CROSS_SURFACE}) {
+        for (auto [width, height] : {std::pair{2, 2}, {3, 2}, {5, 4}, {1, 3}}) {
+            CellArray cells(width, height, topology);
+            for (auto row = 0; row < height; ++row) {
+                for (auto col = 0; col < width; ++col) {
+                    cells.set(col, row, true, CELL_LIVING);
+                }
+            }
+
+            for (auto row = 0; row < height; ++row) {
+                for (auto col = 0; col < width; ++col) {
+                    const auto listed = mooreNeighborhood(col, row, width, height, topology).size();
+                    EXPECT_EQ(static_cast<std::size_t>(cells.countLivingNeighbors(col, row)),
+                            listed);
+                    EXPECT_EQ(ConwayCell(col, row, width, height, true, topology).getNumNeighbors(),
+                            listed);
+                }
+            }
+        }
+    }
+}
+
 ///
 TEST_F(GOLTests, ReadingPlaintextBlockShouldReturn2x2) {
     EXPECT_EQ(myPatternArray.size(), 2);
     EXPECT_EQ(myPatternArray[0].size(), 2);
 }
 
+/// Runs cross word boundaries and line breaks, and nothing after '!' is read
+TEST_F(GOLTests, RLEShouldDecodeStraightIntoTheBitGrid) {
+    namespace fs = std::filesystem;
+    const auto filename = (fs::temp_directory_path() / "gol_rle_decode_test.rle").string();
+    {
+        std::ofstream rle(filename);
+        rle << "#N Edge cases\n#C A comment\nx = 130, y = 5, rule = b36/s23\n"
+            << "2o126b2o$3$6\n4o2A.o!\n2o$o!\n";
+    }
+
+    GOLFile rleFile(filename);
+    auto cells = rleFile.getBitGrid();
+    fs::remove(filename);
+
+    ASSERT_TRUE(cells.has_value());
+    EXPECT_EQ(cells->getWidth(), 130);
+    EXPECT_EQ(cells->getHeight(), 5);
+    EXPECT_EQ(rleFile.getRule(), Rule::parse("B36/S23"));
+    EXPECT_EQ(cells->getPopulation(), 71U);
+    for (auto col : {0, 1, 128, 129}) {
+        EXPECT_TRUE(cells->get(col, 0));
+    }
+    EXPECT_FALSE(cells->get(127, 0));
+    for (auto col = 0; col < 66; ++col) {
+        EXPECT_TRUE(cells->get(col, 4));
+    }
+    EXPECT_FALSE(cells->get(66, 4));
+    EXPECT_TRUE(cells->get(67, 4));
+
+    // Every RLE pattern shipped reads as it did before the decoder: the size, population and
+    // a sum of live cell positions, row * width + col, each taken from the old parser
+    struct ShippedPattern {
+        const char* name;
+        int width;
+        int height;
+        std::uint64_t population;
+        std::uint64_t positionSum;
+    };
+    const ShippedPattern shipped[]{
+            {"glider_color.rle", 47, 9, 80U, 16880U},
+            {"gosperglidergun.rle", 36, 9, 36U, 5798U},
+            {"lwss.rle", 70, 47, 199U, 355856U},
+            {"period20glidergun.rle", 78, 42, 672U, 1254239U},
+            {"pulsarlikeoscillators.rle", 42, 15, 124U, 40686U},
+            {"rpentomino.rle", 3, 3, 5U, 17U},
+            {"spaceships.rle", 36, 5, 38U, 4420U}};
+    for (const auto& pattern : shipped) {
+        GOLFile patternFile((fs::path(TEST_DATA_DIR) / pattern.name).string());
+        auto grid = patternFile.getBitGrid();
+        ASSERT_TRUE(grid.has_value()) << pattern.name;
+        EXPECT_EQ(grid->getWidth(), pattern.width) << pattern.name;
+        EXPECT_EQ(grid->getHeight(), pattern.height) << pattern.name;
+        EXPECT_EQ(grid->getPopulation(), pattern.population) << pattern.name;
+
+        std::uint64_t positionSum = 0;
+        for (auto row = 0; row < grid->getHeight(); ++row) {
+            for (auto col = 0; col < grid->getWidth(); ++col) {
+                positionSum += grid->get(col, row)
+                        ? static_cast<std::uint64_t>(row) * grid->getWidth() + col
+                        : 0;
+            }
+        }
+        EXPECT_EQ(positionSum, pattern.positionSum) << pattern.name;
+    }
+}
+
+/// Runs merge across words and rows, lines wrap at 70 columns, and both formats read back
+TEST_F(GOLTests, WrittenPatternsShouldReadBackTheSame) {
+    namespace fs = std::filesystem;
+    const auto rleName = (fs::temp_directory_path() / "gol_write_test.rle").string();
+    const auto cellsName = (fs::temp_directory_path() / "gol_write_test.cells").string();
+    const auto mcName = (fs::temp_directory_path() / "gol_write_test.mc").string();
+    const auto highLife = Rule::parse("B36/S23").value();
+    GOLFile writer;
+
+    BitGrid cells(200, 6);
+    cells.setRun(60, 0, 10);
+    cells.setRun(0, 3, 200);
+    ASSERT_TRUE(writer.writePatternFile(rleName, cells, highLife));
+    {
+        std::ifstream rle(rleName);
+        std::string line;
+        std::getline(rle, line);
+        EXPECT_EQ(line, "x = 200, y = 6, rule = B36/S23");
+        std::string body;
+        while (std::getline(rle, line)) {
+            EXPECT_LE(line.length(), 70U);
+            body += line;
+        }
+        EXPECT_EQ(body, "60b10o3$200o!");
+    }
+
+    const auto soup = makeSoup(333, 97, {2025});
+    for (const auto& filename : {rleName, cellsName, mcName}) {
+        ASSERT_TRUE(writer.writePatternFile(filename, soup, highLife));
+        GOLFile reader(filename);
+        auto read = reader.getBitGrid();
+        ASSERT_TRUE(read.has_value());
+        EXPECT_EQ(read.value(), soup);
+        fs::remove(filename);
+    }
+
+    // 244 generations carry the glider across the corner of four chunks of the plane
+    auto unboundedGrid = ConwayGrid(PatternArray{".O.", "..O", "OOO"}, {8, 8});
+    unboundedGrid.makeUnbounded();
+    for (auto i = 0; i < 244; ++i) {
+        unboundedGrid.step();
+    }
+    ASSERT_TRUE(unboundedGrid.writePatternFile(rleName));
+    GOLFile reader(rleName);
+    auto glider = reader.getBitGrid();
+    fs::remove(rleName);
+    ASSERT_TRUE(glider.has_value());
+    EXPECT_EQ(toPatternArray(glider.value()), (PatternArray{".O.", "..O", "OOO"}));
+}
+
+/// A Macrocell plane far too large for any grid loads and saves as its handful of nodes
+TEST_F(GOLTests, MacrocellShouldRoundTripThroughHashLife) {
+    namespace fs = std::filesystem;
+    const auto mcName = (fs::temp_directory_path() / "gol_macrocell_test.mc").string();
+    {
+        std::ofstream mc(mcName);
+        mc << "[M2] (golly 4.2)\n#R B36/S23\n#G 7\n.*$..*$***$\n4 0 0 0 1\n";
+    }
+
+    HashLife glider;
+    GOLFile reader(mcName);
+    ASSERT_TRUE(reader.readMacrocell(glider));
+    EXPECT_EQ(reader.getRule().value().getName(), "B36/S23");
+    EXPECT_EQ(glider.getRule().getName(), "B36/S23");
+    EXPECT_EQ(glider.getGeneration(), 7);
+    auto bounds = glider.getBounds();
+    ASSERT_TRUE(bounds.has_value());
+    EXPECT_EQ(bounds->left, 0);
+    EXPECT_EQ(bounds->top, 0);
+    EXPECT_EQ(
+            toPatternArray(glider.getBitGrid(bounds.value())),
+            (PatternArray{".O.", "..O", "OOO"}));
+
+    // Two R-pentominoes 2^40 cells apart span a plane of 2^80 cells
+    const std::int64_t far = std::int64_t{1} << 40;
+    HashLife plane;
+    for (auto origin : {-far, far}) {
+        for (auto [x, y] : {std::pair{1, 0}, {2, 0}, {0, 1}, {1, 1}, {1, 2}}) {
+            plane.setCell(origin + x, origin + y, true);
+        }
+    }
+    GOLFile writer;
+    ASSERT_TRUE(writer.writeMacrocellFile(mcName, plane));
+    EXPECT_LT(fs::file_size(mcName), 4096U);
+
+    HashLife readBack;
+    ASSERT_TRUE(GOLFile(mcName).readMacrocell(readBack));
+    fs::remove(mcName);
+    EXPECT_EQ(readBack.getPopulation(), 10);
+    EXPECT_TRUE(readBack.isAlive(far + 1, far + 2));
+    EXPECT_TRUE(readBack.isAlive(-far, -far + 1));
+    bounds = readBack.getBounds();
+    ASSERT_TRUE(bounds.has_value());
+    EXPECT_EQ(bounds->left, -far);
+    EXPECT_EQ(bounds->width, 2 * far + 3);
+
+    plane.step(1000);
+    readBack.step(1000);
+    EXPECT_EQ(readBack.getPopulation(), plane.getPopulation());
+}
+
+/// A resumed run steps on exactly as the original does; a damaged checkpoint is refused
+TEST_F(GOLTests, CheckpointShouldResumeWhereTheRunLeftOff) {
+    namespace fs = std::filesystem;
+    const auto checkpointName = (fs::temp_directory_path() / "gol_checkpoint_test.ckpt").string();
+
+    auto klein = ConwayGrid(ScreenSize{150, 90}, Topology::KLEIN_BOTTLE);
+    klein.setRule(Rule::parse("B36/S23").value());
+    auto plane = ConwayGrid(PatternArray{".OO", "OO.", ".O."}, {0, 0});
+    plane.makeUnbounded();
+    plane.setViewport(-20, -30);
+    for (auto i = 0; i < 70; ++i) {
+        klein.step();
+        plane.step();
+    }
+
+    for (auto* grid : {&klein, &plane}) {
+        {
+            Checkpointer checkpointer;
+            checkpointer.submit(checkpointName, grid->makeCheckpoint());
+        }
+        auto checkpoint = readCheckpoint(checkpointName);
+        ASSERT_TRUE(checkpoint.has_value());
+        auto resumed = ConwayGrid(checkpoint.value());
+        EXPECT_EQ(resumed.getGeneration(), 70);
+        EXPECT_EQ(resumed.getRule(), grid->getRule());
+        EXPECT_EQ(resumed.getTopology(), grid->getTopology());
+        EXPECT_EQ(resumed.isUnbounded(), grid->isUnbounded());
+        EXPECT_EQ(resumed.getViewportLeft(), grid->getViewportLeft());
+
+        for (auto i = 0; i < 50; ++i) {
+            grid->step();
+            resumed.step();
+        }
+        EXPECT_EQ(resumed.getPopulation(), grid->getPopulation());
+        for (auto row = 0; row < grid->getGridHeight(); ++row) {
+            for (auto col = 0; col < grid->getGridWidth(); ++col) {
+                ASSERT_EQ(resumed.isAlive(col, row), grid->isAlive(col, row));
+            }
+        }
+    }
+
+    // An empty grid is a few runs of zero words
+    auto empty = ConwayGrid(BitGrid(4096, 4096), {0, 0});
+    ASSERT_TRUE(writeCheckpoint(checkpointName, empty.makeCheckpoint()));
+    EXPECT_LT(fs::file_size(checkpointName), 128U);
+
+    fs::resize_file(checkpointName, fs::file_size(checkpointName) - 1);
+    EXPECT_FALSE(readCheckpoint(checkpointName).has_value());
+    fs::remove(checkpointName);
+}
+
 ///
 TEST_F(GOLTests, ConstructingGridFromPatternShouldWork) {
     auto blockGrid = ConwayGrid(myPatternArray, {2, 2});
@@ -135,4 +406,895 @@ TEST_F(GOLTests, ConstructingRandomSoupShouldWork) {
     auto soupGrid = ConwayGrid(GOL_TILING_720P);
     EXPECT_TRUE(soupGrid.getGridWidth() == GOL_TILING_720P.first);
     EXPECT_TRUE(soupGrid.getGridHeight() == GOL_TILING_720P.second);
-}
\ No newline at end of file
+}
+///
+TEST_F(GOLTests, BlinkerShouldOscillateWithTransitionStates) {
+    PatternArray blinker{".....", ".....", ".OOO.", ".....", "....."};
+    auto blinkerGrid = ConwayGrid(blinker, {5, 5});
+
+    blinkerGrid.step();
+    EXPECT_TRUE(blinkerGrid.isAlive(2, 1));
+    EXPECT_TRUE(blinkerGrid.isAlive(2, 3));
+    EXPECT_FALSE(blinkerGrid.isAlive(1, 2));
+    EXPECT_EQ(blinkerGrid.getPendingState(2, 1), CELL_REBORN);
+    EXPECT_EQ(blinkerGrid.getPendingState(2, 2), CELL_LIVING);
+    EXPECT_EQ(blinkerGrid.getPendingState(1, 2), CELL_LONELY);
+    EXPECT_EQ(blinkerGrid.getPendingState(0, 0), CELL_ASLEEP);
+
+    blinkerGrid.step();
+    EXPECT_TRUE(blinkerGrid.isAlive(1, 2));
+    EXPECT_TRUE(blinkerGrid.isAlive(3, 2));
+    EXPECT_FALSE(blinkerGrid.isAlive(2, 1));
+}
+
+///
+TEST_F(GOLTests, ComputeShouldReturnViewOfEachNewGeneration) {
+    PatternArray blinker{".....", ".....", ".OOO.", ".....", "....."};
+    auto blinkerGrid = ConwayGrid(blinker, {5, 5});
+
+    auto generation = blinkerGrid.compute();
+    ASSERT_EQ(generation.size(), 5);
+    ASSERT_EQ(generation[0].size(), 5);
+    EXPECT_TRUE(generation[1][2].isAlive());
+    EXPECT_EQ(generation[1][2].getPendingState(), CELL_REBORN);
+    EXPECT_EQ(generation[2][1].getPendingState(), CELL_LONELY);
+
+    // The swapped buffers are reused, yet the view follows the grid to the next generation
+    blinkerGrid.compute();
+    EXPECT_FALSE(generation[1][2].isAlive());
+    EXPECT_EQ(generation[1][2].getPendingState(), CELL_LONELY);
+    EXPECT_EQ(generation[2][1].getPendingState(), CELL_REBORN);
+
+    auto population = 0;
+    for (const auto& cellRow : generation) {
+        for (const auto& cell : cellRow) {
+            population += cell.isAlive() ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(population, 3);
+}
+
+///
+TEST_F(GOLTests, GliderShouldCrossWrappedEdges) {
+    // A glider travels one cell diagonally every 4 generations, so on a 70x70 torus it is
+    // back where it started after 280 generations, having crossed a word boundary en route
+    PatternArray glider{".O.", "..O", "OOO"};
+    auto wrappedGrid = ConwayGrid(glider, {70, 70}, true);
+    auto start = wrappedGrid.getPendingGrid();
+
+    for (auto i = 0; i < 280; ++i) {
+        wrappedGrid.step();
+    }
+
+    auto finish = wrappedGrid.getPendingGrid();
+    for (auto row = 0; row < wrappedGrid.getGridHeight(); ++row) {
+        for (auto col = 0; col < wrappedGrid.getGridWidth(); ++col) {
+            EXPECT_EQ(start.isAlive(col, row), finish.isAlive(col, row));
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, SupportedKernelsShouldMatchScalarKernel) {
+    const auto soup = makeSoupPattern(2025, 333, 90, 1.0 / 3);
+
+    for (auto wrapped : {false, true}) {
+        auto scalarGrid = ConwayGrid(soup, {0, 0}, wrapped, KernelType::SCALAR);
+        for (auto kernel : {KernelType::SSE2, KernelType::AVX2}) {
+            if (!isKernelSupported(kernel)) {
+                continue;
+            }
+
+            auto referenceGrid = scalarGrid;
+            auto vectorGrid = ConwayGrid(soup, {0, 0}, wrapped, kernel);
+            EXPECT_EQ(vectorGrid.getKernelType(), kernel);
+            for (auto i = 0; i < 50; ++i) {
+                referenceGrid.step();
+                vectorGrid.step();
+            }
+
+            for (auto row = 0; row < vectorGrid.getGridHeight(); ++row) {
+                for (auto col = 0; col < vectorGrid.getGridWidth(); ++col) {
+                    ASSERT_EQ(
+                            vectorGrid.getPendingState(col, row),
+                            referenceGrid.getPendingState(col, row));
+                }
+            }
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, RulesShouldParseFromEitherNotation) {
+    EXPECT_TRUE(Rule().isConway());
+    EXPECT_TRUE(Rule::parse("B3/S23")->isConway());
+    EXPECT_TRUE(Rule::parse("s23/b3")->isConway());
+    EXPECT_TRUE(Rule::parse("23/3")->isConway());
+    EXPECT_TRUE(Rule::parse("B3/S23:T100,100")->isConway());
+
+    auto highLife = Rule::parse("23/36");
+    ASSERT_TRUE(highLife.has_value());
+    EXPECT_EQ(highLife->getName(), "B36/S23");
+    EXPECT_TRUE(highLife->isBorn(6));
+    EXPECT_FALSE(highLife->survives(6));
+
+    auto seeds = Rule::parse("B2/S");
+    ASSERT_TRUE(seeds.has_value());
+    EXPECT_EQ(seeds->getSurvivalCounts(), 0);
+    EXPECT_EQ(seeds->getTable()[2], ~BitWord{0});
+    EXPECT_EQ(seeds->getTable()[NEIGHBOR_COUNTS + 2], 0);
+
+    EXPECT_FALSE(Rule::parse("B03/S23").has_value());
+    EXPECT_FALSE(Rule::parse("345/2/4").has_value());
+    EXPECT_FALSE(Rule::parse("B9/S23").has_value());
+    EXPECT_FALSE(Rule::parse("Life").has_value());
+}
+
+///
+TEST_F(GOLTests, RuleKernelsShouldMatchCellByCellRule) {
+    const auto soup = makeSoupPattern(2025, 150, 40);
+
+    for (const auto* ruleString : {"B36/S23", "B3678/S34678", "B2/S"}) {
+        auto rule = Rule::parse(ruleString).value();
+        for (auto wrapped : {false, true}) {
+            for (auto kernel : {KernelType::SCALAR, KernelType::SSE2, KernelType::AVX2}) {
+                if (!isKernelSupported(kernel)) {
+                    continue;
+                }
+
+                auto grid = ConwayGrid(soup, {0, 0}, wrapped, kernel);
+                grid.setRule(rule);
+                auto cells = grid.getPendingGrid();
+                for (auto i = 0; i < 20; ++i) {
+                    grid.step();
+                    cells.step(rule);
+                }
+
+                for (auto row = 0; row < grid.getGridHeight(); ++row) {
+                    for (auto col = 0; col < grid.getGridWidth(); ++col) {
+                        ASSERT_EQ(grid.getPendingState(col, row), cells.getPendingState(col, row))
+                                << ruleString << " at " << col << ", " << row;
+                    }
+                }
+            }
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, HighLifeReplicatorShouldMatchAcrossEngines) {
+    // The replicator copies itself along a diagonal, so it soon leaves any fixed box
+    PatternArray replicator{"..OOO", ".O..O", "O...O", "O..O.", "OOO.."};
+    auto highLife = Rule::parse("B36/S23").value();
+
+    auto hashLife = HashLife(replicator);
+    hashLife.setRule(highLife);
+    auto unboundedGrid = ConwayGrid(replicator, {0, 0});
+    unboundedGrid.setRule(highLife);
+    unboundedGrid.makeUnbounded();
+
+    hashLife.step(200);
+    for (auto i = 0; i < 200; ++i) {
+        unboundedGrid.step();
+    }
+
+    EXPECT_EQ(unboundedGrid.getPopulation(), hashLife.getPopulation());
+    EXPECT_GT(hashLife.getPopulation(), 12);
+    auto plane = hashLife.getPatternArray(-150, -150, 300, 300);
+    unboundedGrid.setViewport(-150, -150);
+    for (auto row = 0; row < 300; ++row) {
+        for (auto col = 0; col < 300; ++col) {
+            ASSERT_EQ(unboundedGrid.isAlive(col, row), plane[row][col] == PTEXT_LIVE);
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, ChangingTheRuleShouldWakeStillRegions) {
+    // A block is still under B3/S23, so both engines stop stepping around it; under B3/S
+    // nothing survives, and the block must die on the next step
+    PatternArray board(64, std::string(64, PTEXT_DEAD));
+    board[10].replace(10, 2, "OO");
+    board[11].replace(10, 2, "OO");
+    auto noSurvival = Rule::parse("B3/S").value();
+
+    auto boundedGrid = ConwayGrid(board, {0, 0}, false);
+    auto unboundedGrid = ConwayGrid(board, {0, 0});
+    unboundedGrid.makeUnbounded();
+    for (auto* grid : {&boundedGrid, &unboundedGrid}) {
+        grid->step();
+        grid->step();
+        ASSERT_TRUE(grid->isStill());
+        ASSERT_EQ(grid->getPopulation(), 4);
+
+        grid->setRule(noSurvival);
+        grid->step();
+        EXPECT_EQ(grid->getPopulation(), 0);
+        EXPECT_FALSE(grid->isAlive(10, 10));
+    }
+}
+
+///
+TEST_F(GOLTests, StillTilesShouldBeSkipped) {
+    // A blinker in the top left tile and a block in the bottom right one of a 4x4 tile board:
+    // after the first full step only the blinker's tile and its three neighbors stay active
+    PatternArray board(256, std::string(256, PTEXT_DEAD));
+    board[20].replace(20, 3, "OOO");
+    board[200].replace(200, 2, "OO");
+    board[201].replace(200, 2, "OO");
+    auto boardGrid = ConwayGrid(board, {0, 0}, false);
+    EXPECT_EQ(boardGrid.getTileCount(), 16);
+
+    boardGrid.step();
+    EXPECT_EQ(boardGrid.getActiveTileCount(), 16);
+
+    for (auto i = 0; i < 9; ++i) {
+        boardGrid.step();
+        EXPECT_EQ(boardGrid.getActiveTileCount(), 4);
+        EXPECT_DOUBLE_EQ(boardGrid.getActiveTileRatio(), 0.25);
+    }
+
+    EXPECT_EQ(boardGrid.getGeneration(), 10);
+    EXPECT_TRUE(boardGrid.isAlive(20, 20));
+    EXPECT_TRUE(boardGrid.isAlive(22, 20));
+    EXPECT_EQ(boardGrid.getPendingState(20, 20), CELL_REBORN);
+    EXPECT_EQ(boardGrid.getPendingState(21, 19), CELL_LONELY);
+    EXPECT_EQ(boardGrid.getPendingState(201, 201), CELL_LIVING);
+}
+
+///
+TEST_F(GOLTests, GliderShouldCrossTilesOnALargeTorus) {
+    // 400 cells is not a multiple of 64, so the glider also wraps through partial tiles; it
+    // never changes more than the 2x2 tiles it straddles, which activates at most 4x4 tiles
+    PatternArray glider{".O.", "..O", "OOO"};
+    auto wrappedGrid = ConwayGrid(glider, {400, 400}, true);
+    auto start = wrappedGrid.getPendingGrid();
+
+    wrappedGrid.step();
+    EXPECT_EQ(wrappedGrid.getActiveTileCount(), 49);
+    for (auto i = 1; i < 1600; ++i) {
+        wrappedGrid.step();
+        ASSERT_LE(wrappedGrid.getActiveTileCount(), 16);
+    }
+
+    auto finish = wrappedGrid.getPendingGrid();
+    for (auto row = 0; row < wrappedGrid.getGridHeight(); ++row) {
+        for (auto col = 0; col < wrappedGrid.getGridWidth(); ++col) {
+            ASSERT_EQ(start.isAlive(col, row), finish.isAlive(col, row));
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, TopologiesShouldMatchTheirMooreNeighborhoods) {
+    // A soup keeps every tile busy; a glider heading up and left through a mostly idle board
+    // crosses the top edge, where the twisted topologies hand it back mirrored
+    const auto soup = makeSoupPattern(2025, 150, 70, 1.0 / 3);
+
+    PatternArray board(140, std::string(200, PTEXT_DEAD));
+    board[4].replace(90, 3, "OOO");
+    board[5].replace(90, 3, "O..");
+    board[6].replace(90, 3, ".O.");
+
+    for (auto topology :
+         {Topology::BOUNDED, Topology::TORUS, Topology::KLEIN_BOTTLE, Topology::CROSS_SURFACE}) {
+        for (const auto& pattern : {soup, board}) {
+            auto grid = ConwayGrid(pattern, {0, 0}, topology);
+            const auto width = grid.getGridWidth();
+            const auto height = grid.getGridHeight();
+
+            std::vector<NeighborArray> neighborhoods;
+            std::vector<bool> alive;
+            for (auto row = 0; row < height; ++row) {
+                for (auto col = 0; col < width; ++col) {
+                    neighborhoods.push_back(mooreNeighborhood(col, row, width, height, topology));
+                    alive.push_back(grid.isAlive(col, row));
+                }
+            }
+
+            for (auto i = 0; i < 60; ++i) {
+                grid.step();
+                auto next = alive;
+                for (std::size_t cell = 0; cell < alive.size(); ++cell) {
+                    auto count = 0;
+                    for (const auto& [col, row] : neighborhoods[cell]) {
+                        count += alive[row * width + col] ? 1 : 0;
+                    }
+                    next[cell] = count == 3 || (count == 2 && alive[cell]);
+                }
+                alive.swap(next);
+
+                for (auto row = 0; row < height; ++row) {
+                    for (auto col = 0; col < width; ++col) {
+                        ASSERT_EQ(grid.isAlive(col, row), alive[row * width + col])
+                                << topologyName(topology) << " generation " << i + 1 << " at "
+                                << col << ", " << row;
+                    }
+                }
+            }
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, HeadlessRunShouldStopOnceStable) {
+    // Three cells of a block fill in the fourth, and the generation after that changes nothing
+    PatternArray preBlock{"OO", "O."};
+    auto boundedGrid = ConwayGrid(preBlock, {8, 8});
+    auto report = runHeadless(boundedGrid, 100, true);
+    ASSERT_TRUE(report.cycle.has_value());
+    EXPECT_EQ(report.cycle->onset, 1);
+    EXPECT_EQ(report.cycle->period, 1);
+    EXPECT_EQ(report.generations, 2);
+    EXPECT_EQ(report.population, 4);
+    EXPECT_EQ(report.cellUpdates, 2 * 8 * 8);
+
+    auto unboundedGrid = ConwayGrid(preBlock, {8, 8});
+    unboundedGrid.makeUnbounded();
+    report = runHeadless(unboundedGrid, 100, true);
+    EXPECT_TRUE(report.cycle.has_value());
+    EXPECT_EQ(report.generations, 2);
+    EXPECT_EQ(report.population, 4);
+
+    // An oscillator stops once it comes back to its first phase
+    PatternArray blinker{".....", ".....", ".OOO.", ".....", "....."};
+    auto blinkerGrid = ConwayGrid(blinker, {5, 5});
+    report = runHeadless(blinkerGrid, 100, true);
+    ASSERT_TRUE(report.cycle.has_value());
+    EXPECT_EQ(report.cycle->onset, 0);
+    EXPECT_EQ(report.cycle->period, 2);
+    EXPECT_EQ(report.generations, 2);
+    EXPECT_EQ(report.population, 3);
+
+    // A glider on an unbounded plane never repeats, so it runs every generation asked for
+    auto gliderGrid = ConwayGrid(PatternArray{".O.", "..O", "OOO"}, {0, 0});
+    gliderGrid.makeUnbounded();
+    report = runHeadless(gliderGrid, 100, true);
+    EXPECT_FALSE(report.cycle.has_value());
+    EXPECT_EQ(report.generations, 100);
+    EXPECT_EQ(report.population, 5);
+}
+
+/// The state hash kept up step by step matches one computed afresh, and finds the period of a
+/// glider going round a torus
+TEST_F(GOLTests, StateHashShouldFindCyclesOnWrappedGrids) {
+    auto soup = ConwayGrid(ScreenSize{200, 130}, Topology::TORUS);
+    soup.trackStateHash();
+    for (auto i = 0; i < 40; ++i) {
+        soup.step();
+    }
+    auto rehashed = ConwayGrid(soup.makeCheckpoint());
+    rehashed.trackStateHash();
+    EXPECT_EQ(soup.getStateHash(), rehashed.getStateHash());
+
+    auto plane = ConwayGrid(PatternArray{".O.", "..O", "OOO"}, {0, 0});
+    plane.makeUnbounded();
+    const auto startHash = plane.getStateHash();
+    for (auto i = 0; i < 4; ++i) {
+        plane.step();
+    }
+    // Moved one cell diagonally, so a different state
+    EXPECT_NE(plane.getStateHash(), startHash);
+    auto moved = ConwayGrid(plane.makeCheckpoint());
+    EXPECT_EQ(plane.getStateHash(), moved.getStateHash());
+
+    // A glider comes back round a 17 by 17 torus in 68 generations
+    auto torus = ConwayGrid(PatternArray{".O.", "..O", "OOO"}, {17, 17}, Topology::TORUS);
+    ASSERT_EQ(torus.getGridWidth(), 17);
+    ASSERT_EQ(torus.getGridHeight(), 17);
+    for (auto i = 0; i < 10; ++i) {
+        torus.step();
+    }
+    auto report = runHeadless(torus, 1000, true);
+    ASSERT_TRUE(report.cycle.has_value());
+    EXPECT_EQ(report.cycle->onset, 10);
+    EXPECT_EQ(report.cycle->period, 68);
+    EXPECT_EQ(report.generations, 68);
+
+    CycleDetector cycles(4);
+    for (std::uint64_t generation = 0; generation < 10; ++generation) {
+        // Period 5 is beyond a history of 4
+        EXPECT_FALSE(cycles.record(generation, generation % 5 + 1, 3).has_value());
+    }
+}
+
+/// Soups come out the same from the same seed, near their density, and symmetric as asked,
+/// whether their sides are odd or even
+TEST_F(GOLTests, SoupsShouldBeReproducibleAndSymmetric) {
+    EXPECT_EQ(makeSoup(300, 200, {7}), makeSoup(300, 200, {7}));
+    EXPECT_FALSE(makeSoup(300, 200, {7}) == makeSoup(300, 200, {8}));
+
+    const auto sparse = makeSoup(1000, 1000, {7, 0.3});
+    EXPECT_NEAR(static_cast<double>(sparse.getPopulation()) / 1e6, 0.3, 0.005);
+    EXPECT_EQ(makeSoup(130, 70, {7, 0.0}).getPopulation(), 0U);
+    EXPECT_EQ(makeSoup(130, 70, {7, 1.0}).getPopulation(), 130U * 70U);
+
+    // Each cell against its images: half turn, quarter turn, transpose
+    const auto isSymmetric = [](const BitGrid& soup, int side, bool quarter, bool transposed) {
+        for (auto row = 0; row < soup.getHeight(); ++row) {
+            for (auto col = 0; col < soup.getWidth(); ++col) {
+                const auto alive = soup.get(col, row);
+                if (alive != soup.get(soup.getWidth() - 1 - col, soup.getHeight() - 1 - row)
+                    || (quarter && alive != soup.get(side - 1 - row, col))
+                    || (transposed && alive != soup.get(row, col))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    for (auto side : {99, 128, 130}) {
+        const auto seed = static_cast<std::uint64_t>(side);
+        const auto c2 = makeSoup(side, side + 3, {seed, SOUP_DENSITY, SoupSymmetry::C2});
+        EXPECT_TRUE(isSymmetric(c2, side, false, false)) << side;
+        const auto c4 = makeSoup(side, side, {seed, SOUP_DENSITY, SoupSymmetry::C4});
+        EXPECT_TRUE(isSymmetric(c4, side, true, false)) << side;
+        EXPECT_FALSE(isSymmetric(c4, side, true, true)) << side;
+        const auto d8 = makeSoup(side, side, {seed, SOUP_DENSITY, SoupSymmetry::D8});
+        EXPECT_TRUE(isSymmetric(d8, side, true, true)) << side;
+    }
+
+    // Every cell keeps the density, mirror lines included
+    const auto d8 = makeSoup(1001, 1001, {7, 0.3, SoupSymmetry::D8});
+    EXPECT_NEAR(static_cast<double>(d8.getPopulation()) / (1001.0 * 1001.0), 0.3, 0.02);
+
+    // A square soup on a grid that is not square sits in its middle
+    const auto wide = makeSoup(100, 60, {7, SOUP_DENSITY, SoupSymmetry::C4});
+    const auto square = makeSoup(60, 60, {7, SOUP_DENSITY, SoupSymmetry::C4});
+    EXPECT_EQ(wide.getPopulation(), square.getPopulation());
+    for (auto row = 0; row < 60; ++row) {
+        EXPECT_FALSE(wide.get(19, row) || wide.get(80, row));
+    }
+    EXPECT_EQ(parseSoupSymmetry("d8"), SoupSymmetry::D8);
+    EXPECT_FALSE(parseSoupSymmetry("D4").has_value());
+}
+
+/// Objects get their apgsearch names in any phase and orientation, and are found apart even
+/// where they lie close
+TEST_F(GOLTests, ObjectAnalysisShouldSeparateAndNameObjects) {
+    ObjectClassifier classifier;
+    const auto apgcode = [&classifier](const PatternArray& pattern) {
+        return classifier.identify(toBitGrid(pattern)).apgcode;
+    };
+
+    EXPECT_EQ(wechslerCode(toBitGrid({"OO", "OO"})), "33");
+    EXPECT_EQ(apgcode({"OO", "OO"}), "xs4_33");
+    EXPECT_EQ(apgcode({".OO.", "O..O", ".OO."}), "xs6_696");
+    EXPECT_EQ(apgcode({".OO.", "O..O", ".O.O", "..O."}), "xs7_2596");
+    EXPECT_EQ(apgcode({"OO.", "O.O", ".O."}), "xs5_253");
+    EXPECT_EQ(apgcode({".OO.", "O..O", "O..O", ".OO."}), "xs8_6996");
+    EXPECT_EQ(apgcode({"OOO"}), "xp2_7");
+    EXPECT_EQ(apgcode({"O", "O", "O"}), "xp2_7");
+    EXPECT_EQ(apgcode({".OOO", "OOO."}), "xp2_7e");
+    EXPECT_EQ(apgcode({"..O....O..", "OO.OOOO.OO", "..O....O.."}), "xp15_4r4z4r4");
+    EXPECT_EQ(apgcode({".O.", "..O", "OOO"}), "xq4_153");
+    EXPECT_EQ(apgcode({"O.O", ".OO", ".O."}), "xq4_153");
+    EXPECT_EQ(apgcode({".O..O", "O....", "O...O", "OOOO."}), "xq4_6frc");
+    EXPECT_EQ(apgcode({"O.O"}), UNRECOGNIZED_OBJECT);
+
+    const auto glider = classifier.identify(toBitGrid({".O.", "..O", "OOO"}));
+    EXPECT_EQ(glider.period, 4);
+    EXPECT_EQ(glider.dx, 1);
+    EXPECT_EQ(glider.dy, 1);
+
+    // Blocks a column apart share dead neighbors but leave each other be, so they are two
+    ConwayGrid grid({"............",
+                     ".OO.OO......",
+                     ".OO.OO......",
+                     "............",
+                     "............",
+                     "........OOO.",
+                     "............"},
+            {0, 0});
+    const auto objects = classifier.findObjects(grid);
+    ASSERT_EQ(objects.size(), 3U);
+    EXPECT_EQ(objects[0].identity.apgcode, "xs4_33");
+    EXPECT_EQ(objects[0].left, 1);
+    EXPECT_EQ(objects[0].top, 1);
+    EXPECT_EQ(objects[1].identity.apgcode, "xs4_33");
+    EXPECT_EQ(objects[1].left, 4);
+    EXPECT_EQ(objects[2].identity.apgcode, "xp2_7");
+    EXPECT_EQ(objects[2].left, 8);
+    EXPECT_EQ(objects[2].top, 5);
+
+    // A blinker that swings into a block is one object with it
+    const auto mixed = classifier.findObjects(toBitGrid({"OO.O", "OO.O", "...O"}));
+    ASSERT_EQ(mixed.size(), 1U);
+    EXPECT_EQ(mixed.front().identity.apgcode, UNRECOGNIZED_OBJECT);
+}
+
+/// A census is the same on any number of threads, and counts objects by the names it is given
+TEST_F(GOLTests, CensusShouldCountObjectsReproducibly) {
+    // The same seed, the same soup
+    EXPECT_EQ(makeSoup(SOUP_SIZE, SOUP_SIZE, {12345}), makeSoup(SOUP_SIZE, SOUP_SIZE, {12345}));
+    EXPECT_FALSE(
+            makeSoup(SOUP_SIZE, SOUP_SIZE, {12345}) == makeSoup(SOUP_SIZE, SOUP_SIZE, {12346}));
+
+    CensusConfig config;
+    config.soups = 300;
+    config.firstSeed = 1000;
+    config.threadCount = 1;
+    const auto oneThread = runCensus(config);
+    config.threadCount = 4;
+    const auto fourThreads = runCensus(config);
+    EXPECT_EQ(oneThread.objects, fourThreads.objects);
+    EXPECT_EQ(oneThread.generations, fourThreads.generations);
+    EXPECT_EQ(oneThread.unsettled, fourThreads.unsettled);
+    EXPECT_EQ(fourThreads.threadCount, 4);
+
+    // Blocks outnumber everything else in Conway's Life
+    ASSERT_FALSE(oneThread.objects.empty());
+    auto mostCommon = std::max_element(
+            oneThread.objects.begin(),
+            oneThread.objects.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+    EXPECT_EQ(mostCommon->first, "xs4_33");
+
+    // The census counts whatever names it is given: here one per settled soup, by population
+    config.soups = 100;
+    const auto byPopulation = runCensus(config, [](const BitGrid& cells) {
+        return std::vector<std::string>{std::to_string(cells.getPopulation())};
+    });
+    std::uint64_t named = 0;
+    for (const auto& [name, count] : byPopulation.objects) {
+        EXPECT_EQ(name.find_first_not_of("0123456789"), std::string::npos) << name;
+        named += count;
+    }
+    EXPECT_EQ(named, config.soups - byPopulation.unsettled);
+}
+
+///
+TEST_F(GOLTests, BirthsAndDeathsShouldAccountForThePopulation) {
+    const auto soup = makeSoupPattern(7, 200, 150, 0.3);
+
+    for (auto wrapped : {false, true}) {
+        auto soupGrid = ConwayGrid(soup, {0, 0}, wrapped);
+        for (auto generation = 0; generation < 30; ++generation) {
+            auto population = soupGrid.getPopulation();
+            soupGrid.step();
+            EXPECT_EQ(
+                    soupGrid.getPopulation(),
+                    population + soupGrid.getBirths() - soupGrid.getDeaths());
+
+            std::uint64_t living = 0;
+            std::uint64_t reborn = 0;
+            for (auto row = 0; row < soupGrid.getGridHeight(); ++row) {
+                for (auto col = 0; col < soupGrid.getGridWidth(); ++col) {
+                    living += soupGrid.isAlive(col, row) ? 1 : 0;
+                    reborn += soupGrid.getPendingState(col, row) == CELL_REBORN ? 1 : 0;
+                }
+            }
+            EXPECT_EQ(soupGrid.getPopulation(), living);
+            EXPECT_EQ(soupGrid.getBirths(), reborn);
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, TelemetryShouldKeepTheNewestSamples) {
+    Telemetry telemetry(4);
+    EXPECT_TRUE(telemetry.isEmpty());
+    for (std::uint64_t generation = 0; generation < 6; ++generation) {
+        telemetry.record({generation, 1.0f, 0.0f, 10 * generation, generation, 0});
+    }
+
+    EXPECT_EQ(telemetry.getSize(), 4);
+    EXPECT_EQ(telemetry.getSample(0).generation, 2);
+    EXPECT_EQ(telemetry.getLatest().generation, 5);
+    EXPECT_EQ(telemetry.getLatest().population, 50);
+
+    // Only the generations the display showed get a render time
+    Telemetry frames(4);
+    frames.record({3, 0.0f, 7.0f, 30, 3, 0});
+    frames.record({5, 0.0f, 9.0f, 50, 5, 0});
+    telemetry.mergeRenderTimes(frames);
+    EXPECT_FLOAT_EQ(telemetry.getSample(0).renderMicros, 0.0f);
+    EXPECT_FLOAT_EQ(telemetry.getSample(1).renderMicros, 7.0f);
+    EXPECT_FLOAT_EQ(telemetry.getSample(2).renderMicros, 0.0f);
+    EXPECT_FLOAT_EQ(telemetry.getSample(3).renderMicros, 9.0f);
+}
+
+///
+TEST_F(GOLTests, ThreadPoolShouldRunEveryTaskOncePerPass) {
+    ThreadPool threadPool(4);
+    EXPECT_EQ(threadPool.getThreadCount(), 4);
+
+    std::vector<std::atomic<int>> runs(37);
+    for (auto pass = 1; pass <= 100; ++pass) {
+        threadPool.run(static_cast<int>(runs.size()), [&runs](int task) { ++runs[task]; });
+        for (const auto& run : runs) {
+            ASSERT_EQ(run.load(), pass);
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, MultithreadedStepShouldMatchSingleThreadedStep) {
+    // 301 rows split unevenly into bands, so band edges land mid-pattern and off word boundaries
+    const auto soup = makeSoupPattern(4, 197, 301, 1.0 / 3);
+
+    for (auto wrapped : {false, true}) {
+        for (auto threadCount : {2, 3, 7}) {
+            auto singleGrid = ConwayGrid(soup, {0, 0}, wrapped, KernelType::SCALAR);
+            auto bandedGrid = ConwayGrid(soup, {0, 0}, wrapped, KernelType::SCALAR);
+            bandedGrid.setThreadCount(threadCount);
+            EXPECT_EQ(bandedGrid.getThreadCount(), threadCount);
+
+            for (auto i = 0; i < 60; ++i) {
+                singleGrid.step();
+                bandedGrid.step();
+            }
+
+            for (auto row = 0; row < bandedGrid.getGridHeight(); ++row) {
+                for (auto col = 0; col < bandedGrid.getGridWidth(); ++col) {
+                    ASSERT_EQ(
+                            bandedGrid.getPendingState(col, row),
+                            singleGrid.getPendingState(col, row));
+                }
+            }
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, SparseGridShouldMatchHashLife) {
+    // By generation 1000 the R-pentomino has thrown gliders far beyond its starting box
+    PatternArray rPentomino{".OO", "OO.", ".O."};
+    auto hashLife = HashLife(rPentomino);
+    SparseGrid sparseGrid;
+    for (auto row = 0; row < 3; ++row) {
+        for (auto col = 0; col < 3; ++col) {
+            sparseGrid.setCell(col, row, rPentomino[row][col] == PTEXT_LIVE);
+        }
+    }
+
+    hashLife.step(1000);
+    for (auto i = 0; i < 1000; ++i) {
+        sparseGrid.step();
+    }
+
+    EXPECT_EQ(sparseGrid.getGeneration(), 1000);
+    EXPECT_EQ(sparseGrid.getPopulation(), hashLife.getPopulation());
+    auto plane = hashLife.getPatternArray(-300, -300, 600, 600);
+    for (auto row = 0; row < 600; ++row) {
+        for (auto col = 0; col < 600; ++col) {
+            ASSERT_EQ(sparseGrid.isAlive(col - 300, row - 300), plane[row][col] == PTEXT_LIVE);
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, UnboundedGliderShouldLeaveTheViewport) {
+    PatternArray glider{".O.", "..O", "OOO"};
+    auto unboundedGrid = ConwayGrid(glider, {8, 8});
+    unboundedGrid.makeUnbounded();
+    EXPECT_TRUE(unboundedGrid.isUnbounded());
+
+    // 4000 generations carry the glider 1000 cells down and right, through chunks it creates
+    // on the way, while the empty chunks behind it are dropped
+    for (auto i = 0; i < 4000; ++i) {
+        unboundedGrid.step();
+        ASSERT_LE(unboundedGrid.getTileCount(), 4);
+    }
+
+    auto seen = 0;
+    for (auto row = 0; row < 8; ++row) {
+        for (auto col = 0; col < 8; ++col) {
+            seen += unboundedGrid.isAlive(col, row) ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(seen, 0);
+
+    // The glider was padded to start at (2, 2) of the viewport
+    unboundedGrid.setViewport(1000, 1000);
+    EXPECT_EQ(unboundedGrid.getGridWidth(), 8);
+    auto generation = unboundedGrid.getView();
+    for (auto row = 0; row < 8; ++row) {
+        for (auto col = 0; col < 8; ++col) {
+            auto inGlider = row >= 2 && row < 5 && col >= 2 && col < 5;
+            EXPECT_EQ(
+                    generation[row][col].isAlive(),
+                    inGlider && glider[row - 2][col - 2] == PTEXT_LIVE);
+        }
+    }
+}
+
+///
+TEST_F(GOLTests, TripleBufferShouldHandOverWholeValuesInOrder) {
+    // Every published value is a run of one number; a torn or stale read would show up as
+    // mixed numbers or a number going backwards
+    TripleBuffer<std::array<int, 256>> buffer;
+    constexpr int LAST_VALUE{20000};
+
+    std::thread producer([&buffer] {
+        for (auto value = 1; value <= LAST_VALUE; ++value) {
+            buffer.back().fill(value);
+            buffer.publish();
+        }
+    });
+
+    auto lastSeen = 0;
+    while (lastSeen < LAST_VALUE) {
+        if (!buffer.acquire()) {
+            continue;
+        }
+
+        const auto& value = buffer.front();
+        for (auto element : value) {
+            ASSERT_EQ(element, value[0]);
+        }
+        ASSERT_GT(value[0], lastSeen);
+        lastSeen = value[0];
+    }
+    producer.join();
+
+    EXPECT_FALSE(buffer.acquire());
+}
+
+///
+TEST_F(GOLTests, SimulationFramesShouldMatchTheirGeneration) {
+    PatternArray blinker{".....", ".....", ".OOO.", ".....", "....."};
+    Simulation simulation(ConwayGrid(blinker, {5, 5}));
+
+    const auto* initial = simulation.acquireFrame();
+    ASSERT_NE(initial, nullptr);
+    EXPECT_EQ(initial->generation, 0);
+    EXPECT_EQ(initial->states[2 * 5 + 1], CELL_LIVING);
+    EXPECT_EQ(simulation.acquireFrame(), nullptr);
+
+    // Flat out; every frame handed over must be a consistent blinker phase
+    simulation.start(0.0f);
+    std::uint64_t generation = 0;
+    while (generation < 1000) {
+        const auto* frame = simulation.acquireFrame();
+        if (frame == nullptr) {
+            continue;
+        }
+
+        ASSERT_GE(frame->generation, generation);
+        generation = frame->generation;
+        auto vertical = (generation % 2) == 1;
+        EXPECT_EQ(frame->states[1 * 5 + 2], vertical ? CELL_REBORN : CELL_LONELY);
+        EXPECT_EQ(frame->states[2 * 5 + 1], vertical ? CELL_LONELY : CELL_REBORN);
+        EXPECT_EQ(frame->states[2 * 5 + 2], CELL_LIVING);
+    }
+    simulation.stop();
+    EXPECT_FALSE(simulation.isRunning());
+
+    // The last frame always catches up with the grid once stopped
+    const auto* last = simulation.acquireFrame();
+    ASSERT_NE(last, nullptr);
+    EXPECT_EQ(last->generation, simulation.getGrid().getGeneration());
+}
+
+///
+TEST_F(GOLTests, TickSchedulerDeadlinesShouldNotDrift) {
+    using namespace std::chrono_literals;
+
+    // Time only moves when the test moves it, so a stalled test machine cannot shift deadlines
+    TickScheduler::Clock::time_point now{};
+    const auto clock = [&now] { return now; };
+    TickScheduler scheduler(0.01f, clock);
+    EXPECT_FALSE(scheduler.isMaxSpeed());
+
+    // On schedule, each deadline is exactly one period after the last, however long the work
+    // between them took
+    auto first = scheduler.advance();
+    now += 3ms;
+    auto second = scheduler.advance();
+    EXPECT_EQ(first - now, 7ms);
+    EXPECT_EQ(second - first, scheduler.getPeriod());
+
+    // Behind schedule, the next deadline is now rather than a burst of missed ones
+    now += 50ms;
+    auto late = scheduler.advance();
+    EXPECT_EQ(late, now);
+    EXPECT_EQ(scheduler.advance() - late, scheduler.getPeriod());
+
+    TickScheduler maxSpeed(0.0f, clock);
+    EXPECT_TRUE(maxSpeed.isMaxSpeed());
+    EXPECT_EQ(maxSpeed.advance(), now);
+}
+
+///
+TEST_F(GOLTests, SimulationShouldStepGenerationsPerTick) {
+    PatternArray blinker{".....", ".....", ".OOO.", ".....", "....."};
+    Simulation simulation(ConwayGrid(blinker, {5, 5}));
+
+    ASSERT_NE(simulation.acquireFrame(), nullptr);
+
+    // A long tick: the first tick steps right away and hands over its frame, the second is
+    // a minute off, so the run is stopped long before it
+    using Clock = std::chrono::steady_clock;
+    simulation.start(60.0f, 4);
+    const auto timeout = Clock::now() + std::chrono::seconds(10);
+    const Frame* frame = nullptr;
+    while (frame == nullptr && Clock::now() < timeout) {
+        frame = simulation.acquireFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    simulation.stop();
+    ASSERT_NE(frame, nullptr);
+    EXPECT_EQ(frame->generation, 4);
+    EXPECT_EQ(simulation.getGrid().getGeneration(), 4);
+}
+
+///
+TEST_F(GOLTests, HashLifeShouldMatchConwayGrid) {
+    // The R-pentomino stays well inside 256x256 for its first 100 generations, so a bounded
+    // grid of that size is an exact reference; 100 = 64 + 32 + 4 exercises mixed step sizes
+    PatternArray plane(256, std::string(256, PTEXT_DEAD));
+    PatternArray rPentomino{".OO", "OO.", ".O."};
+    for (auto row = 0; row < 3; ++row) {
+        plane[127 + row].replace(127, 3, rPentomino[row]);
+    }
+
+    auto hashLife = HashLife(plane);
+    auto conwayGrid = ConwayGrid(plane, {0, 0}, false);
+    hashLife.step(100);
+    for (auto i = 0; i < 100; ++i) {
+        conwayGrid.step();
+    }
+
+    EXPECT_EQ(hashLife.getGeneration(), 100);
+    auto advanced = hashLife.getPatternArray(0, 0, 256, 256);
+    std::uint64_t population = 0;
+    for (auto row = 0; row < 256; ++row) {
+        for (auto col = 0; col < 256; ++col) {
+            ASSERT_EQ(advanced[row][col] == PTEXT_LIVE, conwayGrid.isAlive(col, row));
+            population += conwayGrid.isAlive(col, row) ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(hashLife.getPopulation(), population);
+}
+
+///
+TEST_F(GOLTests, HashLifeGliderShouldTravelOneCellPerFourGenerations) {
+    auto hashLife = HashLife(PatternArray{".O.", "..O", "OOO"});
+    hashLife.step(std::uint64_t{1} << 20);
+
+    const std::int64_t offset = std::int64_t{1} << 18;
+    EXPECT_EQ(hashLife.getPopulation(), 5);
+    EXPECT_EQ(
+            hashLife.getPatternArray(offset, offset, 3, 3), (PatternArray{".O.", "..O", "OOO"}));
+}
+
+/// Steps that would carry cells beyond 64-bit coordinates are refused, not taken
+TEST_F(GOLTests, HashLifeShouldRefuseStepsBeyondItsPlane) {
+    const PatternArray glider{".O.", "..O", "OOO"};
+    auto hashLife = HashLife(glider);
+    EXPECT_FALSE(hashLife.step(std::uint64_t{1} << 62));
+    EXPECT_FALSE(hashLife.step(~std::uint64_t{0}));
+    EXPECT_FALSE(hashLife.stepPow2(60));
+    EXPECT_EQ(hashLife.getGeneration(), 0U);
+    EXPECT_EQ(hashLife.getPatternArray(0, 0, 3, 3), glider);
+
+    // The glider outruns the deepest root after a few of the largest steps; each one it makes
+    // leaves it whole, HASHLIFE_MAX_GENERATIONS / 4 cells further on
+    auto steps = 0;
+    while (steps < 16 && hashLife.step(HASHLIFE_MAX_GENERATIONS)) {
+        ++steps;
+    }
+    EXPECT_GE(steps, 2);
+    EXPECT_LT(steps, 16);
+    EXPECT_EQ(hashLife.getGeneration(), steps * HASHLIFE_MAX_GENERATIONS);
+    EXPECT_EQ(hashLife.getPopulation(), 5U);
+    const auto offset = static_cast<std::int64_t>(hashLife.getGeneration() / 4);
+    EXPECT_EQ(toPatternArray(hashLife.getBitGrid({offset, offset, 3, 3})), glider);
+}
+
+///
+TEST_F(GOLTests, HashLifeGarbageCollectionShouldKeepThePattern) {
+    auto hashLife = HashLife(PatternArray{".OO", "OO.", ".O."});
+    hashLife.step(1000);
+    const auto population = hashLife.getPopulation();
+    const auto nodeCount = hashLife.getNodeCount();
+
+    hashLife.collectGarbage();
+    EXPECT_LE(hashLife.getNodeCount(), nodeCount);
+    EXPECT_EQ(hashLife.getPopulation(), population);
+
+    // The R-pentomino settles into 116 cells by generation 1103
+    hashLife.step(2000);
+    EXPECT_EQ(hashLife.getPopulation(), 116);
+}
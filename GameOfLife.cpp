@@ -22,54 +22,137 @@
 // SOFTWARE.
 #include "GameOfLife.h"
 
-#include "ConwayCell.h"
+#include "Checkpoint.h"
 #include "ConwayDefs.h"
 #include "ConwayGrid.h"
 #include "GOLConfig.h"
+#include "Simulation.h"
+#include "Telemetry.h"
+#include "Window.h"
 #include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Rect.hpp"
 #include "SFML/Graphics/RectangleShape.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexArray.hpp"
 #include "SFML/System/Time.hpp"
 #include "SFML/System/Vector2.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
 namespace gol {
+namespace {
+/// Two triangles per cell
+constexpr std::size_t VERTICES_PER_CELL{6};
+
+/// RGBA
+constexpr std::size_t BYTES_PER_TEXEL{4};
+
+/// Frames arrive at display rate, so verbose progress is logged no more often than this
+constexpr float REPORT_INTERVAL_SECS{1.0f};
+
+/// Telemetry overlay: one bar per frame shown, the newest on the right
+constexpr std::size_t OVERLAY_BARS{160};
+constexpr float OVERLAY_BAR_WIDTH{2.0f};
+constexpr float OVERLAY_HEIGHT{120.0f};
+constexpr float OVERLAY_MARGIN{8.0f};
+
+/// The overlay is two display frames tall, so a frame's budget sits halfway up
+constexpr float OVERLAY_SPAN_MICROS{2.0e6f / DISPLAY_RATE_HZ};
+
+const sf::Color OVERLAY_PANEL_COLOR{0, 0, 0, 160};
+const sf::Color OVERLAY_BUDGET_COLOR{255, 255, 255, 128};
+const sf::Color OVERLAY_COMPUTE_COLOR{76, 175, 80};
+const sf::Color OVERLAY_RENDER_COLOR{255, 152, 0};
+const sf::Color OVERLAY_POPULATION_COLOR{0, 188, 212};
+
+/// Appends the two triangles of an axis-aligned rectangle
+void appendQuad(sf::VertexArray& vertices, const sf::FloatRect& rect, const sf::Color& color) {
+    const sf::Vector2f topLeft = rect.position;
+    const sf::Vector2f topRight{rect.position.x + rect.size.x, rect.position.y};
+    const sf::Vector2f bottomLeft{rect.position.x, rect.position.y + rect.size.y};
+    const sf::Vector2f bottomRight = rect.position + rect.size;
+
+    for (const auto& corner : {topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight}) {
+        vertices.append(sf::Vertex{corner, color, {0.0f, 0.0f}});
+    }
+}
+
+/// Height of a bar of \p micros, clipped to the overlay
+float overlayHeight(float micros) {
+    return std::min(micros / OVERLAY_SPAN_MICROS * OVERLAY_HEIGHT, OVERLAY_HEIGHT);
+}
+}  // namespace
+
+///
+std::optional<RendererType> parseRendererType(const std::string& name) {
+    std::string lowered(name);
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+
+    for (auto renderer : {RendererType::VERTICES, RendererType::SHAPES, RendererType::TEXTURE}) {
+        if (lowered == rendererName(renderer)) {
+            return renderer;
+        }
+    }
+
+    return std::nullopt;
+}
+
+///
+std::string rendererName(RendererType renderer) {
+    switch (renderer) {
+    case RendererType::SHAPES:
+        return "shapes";
+    case RendererType::TEXTURE:
+        return "texture";
+    default:
+        return "vertices";
+    }
+}
+
 ///
 GameOfLife::GameOfLife(
         std::string& patternName,
         ConwayGrid grid,
         ScreenSize screenSize,
         float tileSize,
-        const GOLConfig& golConfig)
+        const GOLConfig& golConfig,
+        RendererType renderer)
     : m_window(patternName, sf::Vector2u(screenSize.first, screenSize.second))
-    , m_conwayGrid(std::move(grid))
+    , m_simulation(std::move(grid))
     , m_tileSize(tileSize)
     , m_golConfig(golConfig)
-    , m_classicMode(golConfig.isClassicMode()) {
-    restartClock();
-    generateGrid();
-}
-
-///
-GameOfLife::~GameOfLife() = default;
+    , m_classicMode(golConfig.isClassicMode())
+    , m_renderer(renderer) {
+    // Classic mode folds the transitions into live and dead
+    for (auto state : {CELL_ASLEEP, CELL_LONELY, CELL_CHOKED, CELL_LIVING, CELL_REBORN}) {
+        auto shown = state;
+        if (m_classicMode) {
+            shown = (state == CELL_LIVING || state == CELL_REBORN) ? CELL_LIVING : CELL_ASLEEP;
+        }
+        m_cellPalette[state] = sf::Color(m_golConfig.getCellColor(shown));
+    }
 
-///
-sf::Time GameOfLife::getElapsed() {
-    return m_clock.getElapsedTime();
-}
+    // Snapshots are named for the pattern, without its extension
+    m_snapshotPrefix = std::filesystem::path(patternName).stem().string();
 
-///
-void GameOfLife::resetClock() {
-    m_elapsed -= sf::seconds(GAME_INTERVAL);
+    std::clog << "Rendering with " << rendererName(m_renderer) << std::endl;
+    generateGrid();
 }
 
 ///
-void GameOfLife::restartClock() {
-    m_elapsed += m_clock.restart();
-}
+GameOfLife::~GameOfLife() = default;
 
 ///
 Window* GameOfLife::getWindow() {
@@ -81,28 +164,150 @@ void GameOfLife::handleInput() {
     // Input handling.
 }
 
-///
-void GameOfLife::update() {
-    m_conwayGrid.compute();
-    updateGrid();
-    m_window.update();
+/// \note Runs at display rate: handles window events, then shows the newest generation the
+/// simulation thread has handed over, if any
+/// \note Returns whether anything changed, so an idle display can skip drawing altogether
+bool GameOfLife::update() {
+    const auto handled = m_window.update();
+    if (m_window.takeSnapshotRequest()) {
+        m_simulation.requestSnapshot();
+    }
+
+    const auto* frame = m_simulation.acquireFrame();
+    if (frame == nullptr) {
+        return handled;
+    }
+
+    m_renderClock.restart();
+    updateGrid(*frame);
+    m_frameSample = frame->sample;
+    m_frameSample.renderMicros =
+            static_cast<float>(m_renderClock.getElapsedTime().asMicroseconds());
+    m_isFrameNew = true;
+
+    if (m_golConfig.isVerbose()
+        && m_reportClock.getElapsedTime().asSeconds() >= REPORT_INTERVAL_SECS) {
+        m_reportClock.restart();
+        auto ratio = frame->tileCount == 0
+                ? 0.0
+                : 100.0 * static_cast<double>(frame->activeTiles) / frame->tileCount;
+        std::clog << "Generation " << frame->generation << ": " << frame->activeTiles << " of "
+                  << frame->tileCount << " tiles active (" << ratio << "%)" << std::endl;
+    }
+
+    return true;
 }
 
-///
+/// \note A generation's render time covers coloring the grid in update() and drawing it here,
+/// but not the overlay, nor the wait for the next display frame
 void GameOfLife::render() {
+    m_renderClock.restart();
     m_window.beginDraw();
-    for (auto& cellRow : m_cellRectangles) {
-        for (auto& cell : cellRow) {
-            m_window.draw(cell);
+    if (m_renderer == RendererType::TEXTURE) {
+        m_window.draw(*m_cellSprite);
+    } else if (m_renderer == RendererType::VERTICES) {
+        m_window.draw(m_cellVertices);
+    } else {
+        for (auto& cellRow : m_cellRectangles) {
+            for (auto& cell : cellRow) {
+                m_window.draw(cell);
+            }
         }
     }
+
+    if (m_isFrameNew) {
+        m_isFrameNew = false;
+        m_frameSample.renderMicros +=
+                static_cast<float>(m_renderClock.getElapsedTime().asMicroseconds());
+        m_frameTelemetry.record(m_frameSample);
+    }
+
+    if (m_window.isOverlayShown()) {
+        drawOverlay();
+    }
     m_window.endDraw();
 }
 
+/// \note A tick of zero or less runs the simulation flat out; with \p dumpEvery, a snapshot
+/// is written every \p dumpEvery generations, and with \p checkpointEvery, a checkpoint to
+/// <pattern>.ckpt every \p checkpointEvery generations and on stopping
+void GameOfLife::startSimulation(
+        float tickSecs,
+        int generationsPerTick,
+        std::uint64_t dumpEvery,
+        std::uint64_t checkpointEvery) {
+    m_simulation.setSnapshots(m_snapshotPrefix, dumpEvery);
+    m_simulation.setCheckpoints(m_snapshotPrefix + "." + CHECKPOINT, checkpointEvery);
+    m_simulation.start(tickSecs, generationsPerTick);
+}
+
 ///
+void GameOfLife::stopSimulation() {
+    m_simulation.stop();
+}
+
+/// \note Call once the simulation has stopped: the simulation's sample of every generation is
+/// joined with the render times of the generations that were shown
+bool GameOfLife::writeTelemetry(const std::string& filename) const {
+    auto telemetry = m_simulation.getTelemetry();
+    telemetry.mergeRenderTimes(m_frameTelemetry);
+    return telemetry.write(filename);
+}
+
+/// \note PRIVATE
+/// Stacked bars of compute and render time for the newest frames, against a line at one
+/// display frame, with the population traced across them; drawn from shapes alone, so no font
+/// has to ship with the game
+void GameOfLife::drawOverlay() {
+    const auto bars = std::min(m_frameTelemetry.getSize(), OVERLAY_BARS);
+    const auto first = m_frameTelemetry.getSize() - bars;
+    const sf::Vector2f origin{OVERLAY_MARGIN, OVERLAY_MARGIN};
+    const auto baseline = origin.y + OVERLAY_HEIGHT;
+    const auto width = OVERLAY_BARS * OVERLAY_BAR_WIDTH;
+
+    std::uint64_t maxPopulation = 1;
+    for (auto i = first; i < m_frameTelemetry.getSize(); ++i) {
+        maxPopulation = std::max(maxPopulation, m_frameTelemetry.getSample(i).population);
+    }
+
+    m_overlayVertices.clear();
+    appendQuad(m_overlayVertices, {origin, {width, OVERLAY_HEIGHT}}, OVERLAY_PANEL_COLOR);
+    for (std::size_t i = 0; i < bars; ++i) {
+        const auto& sample = m_frameTelemetry.getSample(first + i);
+        const auto x = origin.x + width - (bars - i) * OVERLAY_BAR_WIDTH;
+
+        const auto computeHeight = overlayHeight(sample.computeMicros);
+        const auto renderHeight =
+                std::min(overlayHeight(sample.renderMicros), OVERLAY_HEIGHT - computeHeight);
+        appendQuad(
+                m_overlayVertices,
+                {{x, baseline - computeHeight}, {OVERLAY_BAR_WIDTH, computeHeight}},
+                OVERLAY_COMPUTE_COLOR);
+        appendQuad(
+                m_overlayVertices,
+                {{x, baseline - computeHeight - renderHeight}, {OVERLAY_BAR_WIDTH, renderHeight}},
+                OVERLAY_RENDER_COLOR);
+
+        const auto populationHeight = OVERLAY_HEIGHT * static_cast<float>(sample.population)
+                / static_cast<float>(maxPopulation);
+        appendQuad(
+                m_overlayVertices,
+                {{x, baseline - populationHeight - 1.0f}, {OVERLAY_BAR_WIDTH, 2.0f}},
+                OVERLAY_POPULATION_COLOR);
+    }
+    appendQuad(
+            m_overlayVertices,
+            {{origin.x, baseline - OVERLAY_HEIGHT / 2}, {width, 1.0f}},
+            OVERLAY_BUDGET_COLOR);
+
+    m_window.draw(m_overlayVertices);
+}
+
+/// \note Builds the geometry for the renderer, then colors it from the initial generation
 void GameOfLife::generateGrid() {
-    auto gridHeight = m_conwayGrid.getGridHeight();
-    auto gridWidth = m_conwayGrid.getGridWidth();
+    const auto& conwayGrid = m_simulation.getGrid();
+    auto gridHeight = conwayGrid.getGridHeight();
+    auto gridWidth = conwayGrid.getGridWidth();
 
     auto totalWidth = gridWidth * m_tileSize;
     auto totalHeight = gridHeight * m_tileSize;
@@ -110,61 +315,136 @@ void GameOfLife::generateGrid() {
     sf::Vector2f centroid{0.5f * m_window.getWindowSize().x, 0.5f * m_window.getWindowSize().y};
     sf::Vector2f gridStart = {centroid.x - totalWidth / 2, centroid.y - totalHeight / 2};
 
-    CellArray cellArray = m_conwayGrid.getPendingGrid();
     sf::Vector2f cellSize{m_tileSize - 1.0f, m_tileSize - 1.0f};
-    auto row = 0;
-    for (const auto& cellRow : cellArray) {
-        auto col = 0;
+    if (m_renderer == RendererType::TEXTURE) {
+        genCellTexture(gridStart);
+    } else if (m_renderer == RendererType::VERTICES) {
+        m_cellVertices.clear();
+        for (auto row = 0; row < gridHeight; ++row) {
+            for (auto col = 0; col < gridWidth; ++col) {
+                genCellVertices(
+                        {gridStart.x + col * m_tileSize, gridStart.y + row * m_tileSize},
+                        cellSize);
+            }
+        }
+    } else {
+        generateShapes(gridStart, cellSize);
+    }
+
+    if (const auto* frame = m_simulation.acquireFrame()) {
+        updateGrid(*frame);
+    }
+}
+
+/// \note PRIVATE
+void GameOfLife::generateShapes(const sf::Vector2f& gridStart, const sf::Vector2f& cellSize) {
+    const auto& conwayGrid = m_simulation.getGrid();
+    auto gridHeight = conwayGrid.getGridHeight();
+    auto gridWidth = conwayGrid.getGridWidth();
+    for (auto row = 0; row < gridHeight; ++row) {
         RectangleShapeRow shapeRow{};
-        for (const auto& cell : cellRow) {
+        shapeRow.reserve(gridWidth);
+        for (auto col = 0; col < gridWidth; ++col) {
             sf::Vector2f cellPosition = {
                     gridStart.x + col * m_tileSize, gridStart.y + row * m_tileSize};
-            shapeRow.push_back(genLifeCell(cell, cellPosition, cellSize));
-            ++col;
+            shapeRow.push_back(genLifeCell(CELL_ASLEEP, cellPosition, cellSize));
         }
         m_cellRectangles.push_back(shapeRow);
-        ++row;
     }
 }
 
 /// \note PRIVATE
-void GameOfLife::genCellColor(const ConwayCell& currentCell, sf::RectangleShape& cell) {
-    auto pendingState = currentCell.getPendingState();
-    if (!m_classicMode) {
-        cell.setFillColor(sf::Color(m_golConfig.getCellColor(pendingState)));
-    } else {
-        if (pendingState == CellPending::CELL_LIVING || pendingState == CellPending::CELL_REBORN) {
-            cell.setFillColor(sf::Color(m_golConfig.getCellColor(CellPending::CELL_LIVING)));
-        } else {
-            cell.setFillColor(sf::Color(m_golConfig.getCellColor(CellPending::CELL_ASLEEP)));
-        }
+void GameOfLife::genCellColor(CellPending pendingState, sf::RectangleShape& cell) {
+    cell.setFillColor(genCellColor(pendingState));
+}
+
+/// \note PRIVATE
+const sf::Color& GameOfLife::genCellColor(CellPending pendingState) const {
+    return m_cellPalette[pendingState];
+}
+
+/// \note PRIVATE
+/// One texel per cell, scaled up (or down) to the tile size without smoothing, so cells keep
+/// hard edges at any zoom
+void GameOfLife::genCellTexture(const sf::Vector2f& gridStart) {
+    const auto& conwayGrid = m_simulation.getGrid();
+    const sf::Vector2u textureSize(conwayGrid.getGridWidth(), conwayGrid.getGridHeight());
+    if (!m_cellTexture.resize(textureSize)) {
+        throw std::runtime_error(
+                "Failed to create a " + std::to_string(textureSize.x) + "x"
+                + std::to_string(textureSize.y) + " cell texture");
+    }
+    m_cellTexture.setSmooth(false);
+    m_cellPixels.assign(
+            static_cast<std::size_t>(textureSize.x) * textureSize.y * BYTES_PER_TEXEL, 0);
+
+    m_cellSprite.emplace(m_cellTexture);
+    m_cellSprite->setPosition(gridStart);
+    m_cellSprite->setScale({m_tileSize, m_tileSize});
+}
+
+/// \note PRIVATE
+/// Appends the two triangles of a cell; their colors are filled in by updateGrid()
+void GameOfLife::genCellVertices(const sf::Vector2f& cellPosition, const sf::Vector2f& cellSize) {
+    const sf::Vector2f topRight{cellPosition.x + cellSize.x, cellPosition.y};
+    const sf::Vector2f bottomLeft{cellPosition.x, cellPosition.y + cellSize.y};
+    const sf::Vector2f bottomRight{cellPosition.x + cellSize.x, cellPosition.y + cellSize.y};
+
+    for (const auto& corner :
+         {cellPosition, topRight, bottomLeft, bottomLeft, topRight, bottomRight}) {
+        m_cellVertices.append(sf::Vertex{corner, sf::Color::Black, {0.0f, 0.0f}});
     }
 }
 
 /// \note PRIVATE
 sf::RectangleShape GameOfLife::genLifeCell(
-        const ConwayCell& currentCell,
+        CellPending pendingState,
         const sf::Vector2f& cellPosition,
         const sf::Vector2f& cellSize) {
     sf::RectangleShape cell(cellSize);
     cell.setPosition(cellPosition);
-    genCellColor(currentCell, cell);
+    genCellColor(pendingState, cell);
 
     return cell;
 }
 
 /// \note PRIVATE
-void GameOfLife::updateGrid() {
-    CellArray cells = m_conwayGrid.getPendingGrid();
-    auto row = 0;
-    for (auto& cellRow : m_cellRectangles) {
-        auto col = 0;
-        for (auto& cell : cellRow) {
-            auto currentCell = cells[row][col];
-            genCellColor(currentCell, cell);
-            ++col;
+/// Vertices are only touched for cells whose color changed, which on most boards is few
+void GameOfLife::updateGrid(const Frame& frame) {
+    if (m_renderer == RendererType::TEXTURE) {
+        auto* texel = m_cellPixels.data();
+        for (auto state : frame.states) {
+            const auto& color = genCellColor(static_cast<CellPending>(state));
+            texel[0] = color.r;
+            texel[1] = color.g;
+            texel[2] = color.b;
+            texel[3] = color.a;
+            texel += BYTES_PER_TEXEL;
+        }
+        m_cellTexture.update(m_cellPixels.data());
+        return;
+    }
+
+    if (m_renderer == RendererType::VERTICES) {
+        std::size_t vertex = 0;
+        for (auto state : frame.states) {
+            const auto& color = genCellColor(static_cast<CellPending>(state));
+            if (m_cellVertices[vertex].color != color) {
+                for (std::size_t i = 0; i < VERTICES_PER_CELL; ++i) {
+                    m_cellVertices[vertex + i].color = color;
+                }
+            }
+            vertex += VERTICES_PER_CELL;
+        }
+        return;
+    }
+
+    auto state = frame.states.begin();
+    for (auto& shapeRow : m_cellRectangles) {
+        for (auto& shape : shapeRow) {
+            genCellColor(static_cast<CellPending>(*state), shape);
+            ++state;
         }
-        ++row;
     }
 }
 
@@ -23,8 +23,13 @@
 #pragma once
 #include "ConwayGrid.h"
 #include "GOLConfig.h"
+#include "Simulation.h"
+#include "Telemetry.h"
 #include "Window.h"
 
+#include <array>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -32,7 +37,12 @@ namespace gol {
 using RectangleShapeRow = std::vector<sf::RectangleShape>;
 using RectangleShapeArray = std::vector<RectangleShapeRow>;
 
-constexpr float GAME_INTERVAL{1.0};
+/// Vertices batch the whole grid into one draw call; shapes draw each cell on its own;
+/// texture uploads one texel per cell and lets the GPU scale it, even below a pixel per cell
+enum class RendererType { VERTICES, SHAPES, TEXTURE };
+
+std::optional<RendererType> parseRendererType(const std::string& name);
+std::string rendererName(RendererType renderer);
 
 ///
 class GameOfLife {
@@ -42,39 +52,63 @@ public:
             ConwayGrid grid,
             ScreenSize screenSize,
             float tileSize,
-            const GOLConfig& golConfig);
+            const GOLConfig& golConfig,
+            RendererType renderer = RendererType::VERTICES);
     ~GameOfLife();
 
     void handleInput();
-    void update();
+    bool update();
     void render();
 
-    Window* getWindow();
+    void startSimulation(
+            float tickSecs,
+            int generationsPerTick = 1,
+            std::uint64_t dumpEvery = 0,
+            std::uint64_t checkpointEvery = 0);
+    void stopSimulation();
+    bool writeTelemetry(const std::string& filename) const;
 
-    sf::Time getElapsed();
-    void resetClock();
-    void restartClock();
+    Window* getWindow();
 
 private:
+    void drawOverlay();
     void generateGrid();
+    void generateShapes(const sf::Vector2f& gridStart, const sf::Vector2f& cellSize);
 
-    void genCellColor(const ConwayCell& currentCell, sf::RectangleShape& cell);
+    void genCellColor(CellPending pendingState, sf::RectangleShape& cell);
+    const sf::Color& genCellColor(CellPending pendingState) const;
+    void genCellTexture(const sf::Vector2f& gridStart);
+    void genCellVertices(const sf::Vector2f& cellPosition, const sf::Vector2f& cellSize);
 
     sf::RectangleShape genLifeCell(
-            const ConwayCell& currentCell,
+            CellPending pendingState,
             const sf::Vector2f& cellPosition,
             const sf::Vector2f& cellSize);
 
-    void updateGrid();
+    void updateGrid(const Frame& frame);
 
     Window m_window;
-    ConwayGrid m_conwayGrid;
+    Simulation m_simulation;
+    std::string m_snapshotPrefix;
     float m_tileSize{16.0};
     GOLConfig m_golConfig;
 
-    sf::Clock m_clock{};
-    sf::Time m_elapsed;
+    sf::Clock m_reportClock{};
     RectangleShapeArray m_cellRectangles;
+    sf::VertexArray m_cellVertices{sf::PrimitiveType::Triangles};
+    std::vector<std::uint8_t> m_cellPixels;
+    sf::Texture m_cellTexture;
+    std::optional<sf::Sprite> m_cellSprite;
+
+    /// One sample per generation shown, with the time spent coloring and drawing it
+    Telemetry m_frameTelemetry;
+    TelemetrySample m_frameSample;
+    bool m_isFrameNew{false};
+    sf::Clock m_renderClock{};
+    sf::VertexArray m_overlayVertices{sf::PrimitiveType::Triangles};
+
+    std::array<sf::Color, CELL_REBORN + 1> m_cellPalette;
     bool m_classicMode{false};
+    RendererType m_renderer{RendererType::VERTICES};
 };
 }  // namespace gol
\ No newline at end of file
@@ -0,0 +1,116 @@
+/// \file GridView.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "GridView.h"
+
+#include "ConwayDefs.h"
+#include "ConwayGrid.h"
+
+#include <cstddef>
+
+namespace gol {
+
+///
+CellView::CellView(const ConwayGrid& grid, int col, int row)
+    : m_grid(&grid)
+    , m_col(col)
+    , m_row(row) {}
+
+///
+int CellView::getCol() const {
+    return m_col;
+}
+
+///
+CellPending CellView::getPendingState() const {
+    return m_grid->getPendingState(m_col, m_row);
+}
+
+///
+int CellView::getRow() const {
+    return m_row;
+}
+
+///
+bool CellView::isAlive() const {
+    return m_grid->isAlive(m_col, m_row);
+}
+
+///
+RowView::RowView(const ConwayGrid& grid, int row)
+    : m_grid(&grid)
+    , m_row(row) {}
+
+///
+CellView RowView::operator[](int col) const {
+    return {*m_grid, col, m_row};
+}
+
+///
+RowView::iterator RowView::begin() const {
+    return {*this, 0};
+}
+
+///
+RowView::iterator RowView::end() const {
+    return {*this, m_grid->getGridWidth()};
+}
+
+///
+bool RowView::empty() const {
+    return m_grid->getGridWidth() == 0;
+}
+
+///
+std::size_t RowView::size() const {
+    return static_cast<std::size_t>(m_grid->getGridWidth());
+}
+
+///
+GridView::GridView(const ConwayGrid& grid)
+    : m_grid(&grid) {}
+
+///
+RowView GridView::operator[](int row) const {
+    return {*m_grid, row};
+}
+
+///
+GridView::iterator GridView::begin() const {
+    return {*this, 0};
+}
+
+///
+GridView::iterator GridView::end() const {
+    return {*this, m_grid->getGridHeight()};
+}
+
+///
+bool GridView::empty() const {
+    return m_grid->getGridHeight() == 0 || m_grid->getGridWidth() == 0;
+}
+
+///
+std::size_t GridView::size() const {
+    return static_cast<std::size_t>(m_grid->getGridHeight());
+}
+}  // namespace gol
@@ -0,0 +1,126 @@
+/// \file GridView.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "ConwayDefs.h"
+
+#include <cstddef>
+#include <iterator>
+
+namespace gol {
+class ConwayGrid;
+
+/// Iterates an owner's elements by index, yielding lightweight views by value
+template<typename Owner, typename Value>
+class ViewIterator {
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Value;
+
+    ViewIterator(const Owner& owner, int index)
+        : m_owner(&owner)
+        , m_index(index) {}
+
+    Value operator*() const {
+        return (*m_owner)[m_index];
+    }
+
+    ViewIterator& operator++() {
+        ++m_index;
+        return *this;
+    }
+
+    ViewIterator operator++(int) {
+        auto previous = *this;
+        ++m_index;
+        return previous;
+    }
+
+    bool operator==(const ViewIterator& rhs) const {
+        return m_index == rhs.m_index;
+    }
+
+    bool operator!=(const ViewIterator& rhs) const {
+        return m_index != rhs.m_index;
+    }
+
+private:
+    const Owner* m_owner;
+    int m_index;
+};
+
+/// One cell of the current generation
+class CellView {
+public:
+    CellView(const ConwayGrid& grid, int col, int row);
+
+    int getCol() const;
+    CellPending getPendingState() const;
+    int getRow() const;
+    bool isAlive() const;
+
+private:
+    const ConwayGrid* m_grid;
+    int m_col;
+    int m_row;
+};
+
+/// One row of the current generation
+class RowView {
+public:
+    using iterator = ViewIterator<RowView, CellView>;
+
+    RowView(const ConwayGrid& grid, int row);
+
+    CellView operator[](int col) const;
+    iterator begin() const;
+    iterator end() const;
+    bool empty() const;
+    std::size_t size() const;
+
+private:
+    const ConwayGrid* m_grid;
+    int m_row;
+};
+
+/// Read-only view of a ConwayGrid's current generation, iterable as rows of cells
+/// \note Nothing is copied: the view reads through to the grid, so it always shows the
+/// latest generation and must not outlive the grid
+class GridView {
+public:
+    using iterator = ViewIterator<GridView, RowView>;
+
+    explicit GridView(const ConwayGrid& grid);
+
+    RowView operator[](int row) const;
+    iterator begin() const;
+    iterator end() const;
+    bool empty() const;
+    std::size_t size() const;
+
+private:
+    const ConwayGrid* m_grid;
+};
+}  // namespace gol
@@ -0,0 +1,981 @@
+/// \file HashLife.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "HashLife.h"
+
+#include "ConwayDefs.h"
+#include "GOLFile.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gol {
+namespace {
+constexpr std::size_t INITIAL_TABLE_SIZE{1 << 16};
+constexpr int MIN_ROOT_LEVEL{3};
+/// Deepest root the plane grows to: its cells, and the sums of node corners and sizes taken
+/// while walking it, stay well inside 64-bit coordinates
+constexpr int MAX_ROOT_LEVEL{62};
+/// Largest single jump, which stepPow2() needs a root log2Generations + 3 deep for, and then
+/// room to center the pattern
+constexpr unsigned int MAX_STEP_LOG2{57};
+static_assert(MAX_STEP_LOG2 + 3 < MAX_ROOT_LEVEL);
+/// A pattern near (0, 0) that spreads at the speed of light for this long still fits in the
+/// inner quarter of the deepest root
+static_assert(HASHLIFE_MAX_GENERATIONS <= std::uint64_t{1} << (MAX_ROOT_LEVEL - 4));
+
+/// Level of a node as wide as a BitGrid word
+constexpr int WORD_LEVEL{6};
+static_assert((1 << WORD_LEVEL) == BITS_PER_WORD);
+
+/// Deepest node read from a Macrocell file, leaving the root room to expand before its cells
+/// outrun 64-bit coordinates
+constexpr std::uint64_t MC_MAX_LEVEL{60};
+
+/// Reads the whitespace-separated numbers making up the whole of \p line into \p fields
+bool parseFields(std::string_view line, std::array<std::uint64_t, 5>& fields) {
+    const auto* next = line.data();
+    const auto* end = next + line.size();
+    for (auto& field : fields) {
+        while (next != end && *next == ' ') {
+            ++next;
+        }
+
+        auto [ptr, ec] = std::from_chars(next, end, field);
+        if (ec != std::errc{}) {
+            return false;
+        }
+        next = ptr;
+    }
+
+    return next == end;
+}
+
+///
+std::size_t hashChildren(NodeId nw, NodeId ne, NodeId sw, NodeId se) {
+    std::uint64_t hash = nw;
+    hash = hash * 0x9E3779B97F4A7C15ULL + ne;
+    hash = hash * 0x9E3779B97F4A7C15ULL + sw;
+    hash = hash * 0x9E3779B97F4A7C15ULL + se;
+    hash ^= hash >> 29;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 32;
+    return static_cast<std::size_t>(hash);
+}
+}  // namespace
+
+///
+HashLife::HashLife(std::size_t memoryBudget)
+    : m_table(INITIAL_TABLE_SIZE, NO_NODE)
+    , m_memoryBudget(memoryBudget) {
+    Node deadLeaf;
+    m_nodes.push_back(deadLeaf);
+
+    Node liveLeaf;
+    liveLeaf.population = 1;
+    m_nodes.push_back(liveLeaf);
+
+    m_emptyNodes.push_back(DEAD_LEAF);
+    m_root = emptyNode(MIN_ROOT_LEVEL);
+}
+
+/// \note Places the pattern's top left corner at (0, 0)
+HashLife::HashLife(const PatternArray& patternArray, std::size_t memoryBudget)
+    : HashLife(memoryBudget) {
+    std::size_t extent = patternArray.size();
+    for (const auto& row : patternArray) {
+        extent = std::max(extent, row.length());
+    }
+
+    auto level = MIN_ROOT_LEVEL;
+    while ((std::size_t{1} << (level - 1)) < extent) {
+        ++level;
+    }
+
+    auto empty = emptyNode(level - 1);
+    auto pattern =
+            buildFromPattern(patternArray, static_cast<std::int64_t>(extent), level - 1, 0, 0);
+    m_root = join(empty, empty, empty, pattern);
+}
+
+/// \note Places the grid's top left corner at (0, 0), as the PatternArray constructor does
+HashLife::HashLife(const BitGrid& cells, std::size_t memoryBudget)
+    : HashLife(memoryBudget) {
+    const auto extent = std::max(cells.getWidth(), cells.getHeight());
+
+    auto level = MIN_ROOT_LEVEL;
+    while ((std::int64_t{1} << (level - 1)) < extent) {
+        ++level;
+    }
+
+    auto empty = emptyNode(level - 1);
+    m_root = join(empty, empty, empty, buildFromBitGrid(cells, level - 1, 0, 0));
+}
+
+/// \note Frees every node unreachable from the root, and forgets memoized results that
+/// pointed at them; results within the surviving tree stay cached
+void HashLife::collectGarbage() {
+    for (auto& node : m_nodes) {
+        node.marked = false;
+    }
+
+    for (auto id : m_emptyNodes) {
+        mark(id);
+    }
+    mark(LIVE_LEAF);
+    mark(m_root);
+
+    std::fill(m_table.begin(), m_table.end(), NO_NODE);
+    m_tableCount = 0;
+    m_freeNodes.clear();
+
+    const auto mask = m_table.size() - 1;
+    for (NodeId id = 0; id < m_nodes.size(); ++id) {
+        auto& node = m_nodes[id];
+        if (!node.marked) {
+            node = Node{};
+            m_freeNodes.push_back(id);
+            continue;
+        }
+
+        if (node.result != NO_NODE && !m_nodes[node.result].marked) {
+            node.result = NO_NODE;
+            node.resultStep = -1;
+        }
+
+        if (node.level > 0) {
+            auto slot = hashChildren(node.nw, node.ne, node.sw, node.se) & mask;
+            while (m_table[slot] != NO_NODE) {
+                slot = (slot + 1) & mask;
+            }
+            m_table[slot] = id;
+            ++m_tableCount;
+        }
+    }
+}
+
+/// \note Extracts \p window of the plane, as getPatternArray does, straight into grid words
+BitGrid HashLife::getBitGrid(const PlaneRect& window) const {
+    BitGrid cells(static_cast<int>(window.width), static_cast<int>(window.height));
+    if (window.width > 0 && window.height > 0) {
+        auto half = std::int64_t{1} << (m_nodes[m_root].level - 1);
+        renderBits(m_root, -half, -half, window, cells);
+    }
+
+    return cells;
+}
+
+/// Smallest rectangle holding every live cell; nothing for an empty plane
+/// \note Each distinct node is bounded once, so the walk follows the compressed tree rather
+/// than the area it covers
+std::optional<PlaneRect> HashLife::getBounds() const {
+    std::unordered_map<NodeId, NodeBounds> found;
+    auto bounds = findBounds(m_root, found);
+    if (!bounds.has_value()) {
+        return std::nullopt;
+    }
+
+    auto half = std::int64_t{1} << (m_nodes[m_root].level - 1);
+    return PlaneRect{
+            bounds->left - half,
+            bounds->top - half,
+            bounds->right - bounds->left + 1,
+            bounds->bottom - bounds->top + 1};
+}
+
+///
+std::uint64_t HashLife::getGeneration() const {
+    return m_generation;
+}
+
+/// \note Bytes held by live nodes and the node table
+std::size_t HashLife::getMemoryUsage() const {
+    return getNodeCount() * sizeof(Node) + m_table.size() * sizeof(NodeId);
+}
+
+///
+std::size_t HashLife::getNodeCount() const {
+    return m_nodes.size() - m_freeNodes.size();
+}
+
+/// \note Extracts the window [left, left + width) x [top, top + height) of the plane
+PatternArray
+HashLife::getPatternArray(std::int64_t left, std::int64_t top, int width, int height) const {
+    PatternArray patternArray(height, std::string(width, PTEXT_DEAD));
+    if (width > 0 && height > 0) {
+        auto half = std::int64_t{1} << (m_nodes[m_root].level - 1);
+        renderNode(m_root, -half, -half, left, top, patternArray);
+    }
+
+    return patternArray;
+}
+
+///
+std::uint64_t HashLife::getPopulation() const {
+    return m_nodes[m_root].population;
+}
+
+///
+const Rule& HashLife::getRule() const {
+    return m_rule;
+}
+
+///
+bool HashLife::isAlive(std::int64_t x, std::int64_t y) const {
+    auto id = m_root;
+    auto level = m_nodes[id].level;
+    auto half = std::int64_t{1} << (level - 1);
+    if (x < -half || x >= half || y < -half || y >= half) {
+        return false;
+    }
+
+    while (level > 1) {
+        const auto& node = m_nodes[id];
+        if (node.population == 0) {
+            return false;
+        }
+
+        auto quarter = std::int64_t{1} << (level - 2);
+        id = (y < 0) ? (x < 0 ? node.nw : node.ne) : (x < 0 ? node.sw : node.se);
+        x += (x < 0) ? quarter : -quarter;
+        y += (y < 0) ? quarter : -quarter;
+        --level;
+    }
+
+    const auto& node = m_nodes[id];
+    return ((y < 0) ? (x < 0 ? node.nw : node.ne) : (x < 0 ? node.sw : node.se)) == LIVE_LEAF;
+}
+
+/// Replaces the plane with the quadtree of a Macrocell file, its root centered on (0, 0)
+/// \note Each line is joined into a node as it is read, so memory grows with the distinct
+/// nodes of the file, never with the area they cover. Header and comment lines are the
+/// caller's to interpret, and are skipped here.
+/// \see https://conwaylife.com/wiki/Macrocell
+bool HashLife::loadMacrocell(std::string_view text) {
+    // Index 0 stands for an empty quadrant of whichever level its parent needs
+    std::vector<NodeId> ids{NO_NODE};
+    std::size_t pos = 0;
+    while (pos < text.size()) {
+        const auto eol = std::min(text.find('\n', pos), text.size());
+        auto line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+
+        while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back()))) {
+            line.remove_suffix(1);
+        }
+        if (line.empty() || line[0] == MC_HEADER[0] || line[0] == MC_DELIM) {
+            continue;
+        }
+
+        const auto id = parseMacrocellLine(line, ids);
+        if (id == NO_NODE) {
+            std::cerr << "Malformed Macrocell node " << ids.size() << ": " << line << std::endl;
+            return false;
+        }
+        ids.push_back(id);
+    }
+
+    if (ids.size() == 1) {
+        std::cerr << "No Macrocell nodes found" << std::endl;
+        return false;
+    }
+
+    m_root = ids.back();
+    while (m_nodes[m_root].level < MIN_ROOT_LEVEL) {
+        expand();
+    }
+
+    return true;
+}
+
+/// Writes the plane as Macrocell lines: 8x8 leaves, then each node after its quadrants, the
+/// root last
+/// \note Shared subtrees are written once, so the output grows with the distinct nodes of the
+/// plane rather than its area; the header is left to the caller
+void HashLife::saveMacrocell(std::ostream& out) const {
+    if (m_nodes[m_root].population == 0) {
+        // A lone empty leaf, so that the empty plane still reads back
+        out << MC_EOL << '\n';
+        return;
+    }
+
+    std::unordered_map<NodeId, std::uint64_t> indexes;
+    std::uint64_t nextIndex = 1;
+    writeMacrocellNode(m_root, indexes, nextIndex, out);
+}
+
+/// \note A cell beyond the deepest root's reach is left out
+void HashLife::setCell(std::int64_t x, std::int64_t y, bool alive) {
+    for (;;) {
+        auto half = std::int64_t{1} << (m_nodes[m_root].level - 1);
+        if (x >= -half && x < half && y >= -half && y < half) {
+            break;
+        }
+        if (m_nodes[m_root].level >= MAX_ROOT_LEVEL) {
+            std::cerr << "Error: Cell (" << x << ", " << y << ") is beyond the HashLife plane"
+                      << std::endl;
+            return;
+        }
+        expand();
+    }
+
+    m_root = setCell(m_root, x, y, alive);
+}
+
+/// \note For a plane read back at the generation it was saved
+void HashLife::setGeneration(std::uint64_t generation) {
+    m_generation = generation;
+}
+
+/// \note Every memoized future was worked out under the old rule, so all of them are forgotten
+void HashLife::setRule(const Rule& rule) {
+    if (rule == m_rule) {
+        return;
+    }
+
+    m_rule = rule;
+    for (auto& node : m_nodes) {
+        node.result = NO_NODE;
+        node.resultStep = -1;
+    }
+}
+
+/// Advances \p generations, no more than HASHLIFE_MAX_GENERATIONS, decomposed into powers of
+/// two; the powers above MAX_STEP_LOG2 are taken as repeated jumps of 2^MAX_STEP_LOG2
+/// \note False if the count is too large, or the pattern has spread beyond the deepest root;
+/// the plane is left at the last generation it reached
+bool HashLife::step(std::uint64_t generations) {
+    if (generations > HASHLIFE_MAX_GENERATIONS) {
+        std::cerr << "Error: HashLife steps at most " << HASHLIFE_MAX_GENERATIONS
+                  << " generations at a time, not " << generations << std::endl;
+        return false;
+    }
+
+    for (auto jumps = generations >> MAX_STEP_LOG2; jumps != 0; --jumps) {
+        if (!stepPow2(MAX_STEP_LOG2)) {
+            return false;
+        }
+    }
+    generations &= (std::uint64_t{1} << MAX_STEP_LOG2) - 1;
+    for (unsigned int log2Generations = 0; generations != 0; ++log2Generations) {
+        if ((generations & 1U) != 0 && !stepPow2(log2Generations)) {
+            return false;
+        }
+        generations >>= 1U;
+    }
+
+    return true;
+}
+
+/// \note The root is first padded until the pattern sits in its inner quarter and the
+/// root is large enough for the step, so nothing can escape the computed center; false,
+/// with the plane unchanged, for a jump beyond 2^MAX_STEP_LOG2 or a root that would have to
+/// grow past MAX_ROOT_LEVEL
+bool HashLife::stepPow2(unsigned int log2Generations) {
+    if (log2Generations > MAX_STEP_LOG2) {
+        std::cerr << "Error: HashLife jumps at most 2^" << MAX_STEP_LOG2
+                  << " generations at a time, not 2^" << log2Generations << std::endl;
+        return false;
+    }
+
+    while (m_nodes[m_root].level < log2Generations + 3 || !fitsInInnerCenter(m_root)) {
+        if (m_nodes[m_root].level >= MAX_ROOT_LEVEL) {
+            std::cerr << "Error: Pattern has spread too far for HashLife to step at generation "
+                      << m_generation << std::endl;
+            return false;
+        }
+        expand();
+    }
+
+    m_root = successor(m_root, static_cast<int>(log2Generations));
+    m_generation += std::uint64_t{1} << log2Generations;
+
+    if (getMemoryUsage() > m_memoryBudget) {
+        collectGarbage();
+    }
+
+    return true;
+}
+
+/// \note PRIVATE
+/// Builds the node of \p level whose top left corner is at (left, top) of the grid
+/// \note A 64x64 block lines up with the grid's words, so an empty one is passed over a row at
+/// a time rather than a cell at a time
+NodeId HashLife::buildFromBitGrid(
+        const BitGrid& cells,
+        int level,
+        std::int64_t left,
+        std::int64_t top) {
+    if (top >= cells.getHeight() || left >= cells.getWidth()) {
+        return emptyNode(level);
+    }
+
+    if (level == 0) {
+        return cells.get(static_cast<int>(left), static_cast<int>(top)) ? LIVE_LEAF : DEAD_LEAF;
+    }
+
+    if (level == WORD_LEVEL) {
+        const auto bottom = std::min<std::int64_t>(top + BITS_PER_WORD, cells.getHeight());
+        auto live = false;
+        for (auto row = top; row < bottom && !live; ++row) {
+            live = cells.rowWords(static_cast<int>(row))[left / BITS_PER_WORD] != 0;
+        }
+        if (!live) {
+            return emptyNode(level);
+        }
+    }
+
+    auto half = std::int64_t{1} << (level - 1);
+    return join(
+            buildFromBitGrid(cells, level - 1, left, top),
+            buildFromBitGrid(cells, level - 1, left + half, top),
+            buildFromBitGrid(cells, level - 1, left, top + half),
+            buildFromBitGrid(cells, level - 1, left + half, top + half));
+}
+
+/// \note PRIVATE
+/// Builds the node of \p level whose top left corner is at (left, top) of a Macrocell leaf
+NodeId HashLife::buildFromLeafRows(const LeafRows& rows, int level, int left, int top) {
+    if (level == 0) {
+        return ((rows[top] >> left) & 1U) != 0 ? LIVE_LEAF : DEAD_LEAF;
+    }
+
+    auto half = 1 << (level - 1);
+    return join(
+            buildFromLeafRows(rows, level - 1, left, top),
+            buildFromLeafRows(rows, level - 1, left + half, top),
+            buildFromLeafRows(rows, level - 1, left, top + half),
+            buildFromLeafRows(rows, level - 1, left + half, top + half));
+}
+
+/// \note PRIVATE
+/// Builds the node of \p level whose top left corner is at (left, top) of the pattern
+NodeId HashLife::buildFromPattern(
+        const PatternArray& patternArray,
+        std::int64_t extent,
+        int level,
+        std::int64_t left,
+        std::int64_t top) {
+    auto size = std::int64_t{1} << level;
+    if (top >= static_cast<std::int64_t>(patternArray.size()) || left >= extent) {
+        return emptyNode(level);
+    }
+
+    if (level == 0) {
+        const auto& row = patternArray[top];
+        return (left < static_cast<std::int64_t>(row.length()) && row[left] == PTEXT_LIVE)
+                ? LIVE_LEAF
+                : DEAD_LEAF;
+    }
+
+    auto half = size / 2;
+    return join(
+            buildFromPattern(patternArray, extent, level - 1, left, top),
+            buildFromPattern(patternArray, extent, level - 1, left + half, top),
+            buildFromPattern(patternArray, extent, level - 1, left, top + half),
+            buildFromPattern(patternArray, extent, level - 1, left + half, top + half));
+}
+
+/// \note PRIVATE
+NodeId HashLife::centerOf(NodeId id) {
+    const auto node = m_nodes[id];
+    return join(
+            m_nodes[node.nw].se, m_nodes[node.ne].sw, m_nodes[node.sw].ne, m_nodes[node.se].nw);
+}
+
+/// \note PRIVATE
+NodeId HashLife::emptyNode(int level) {
+    while (static_cast<int>(m_emptyNodes.size()) <= level) {
+        auto empty = m_emptyNodes.back();
+        m_emptyNodes.push_back(join(empty, empty, empty, empty));
+    }
+
+    return m_emptyNodes[level];
+}
+
+/// \note PRIVATE
+/// Doubles the root, keeping the existing plane centered
+void HashLife::expand() {
+    const auto root = m_nodes[m_root];
+    auto empty = emptyNode(root.level - 1);
+    m_root = join(
+            join(empty, empty, empty, root.nw),
+            join(empty, empty, root.ne, empty),
+            join(empty, root.sw, empty, empty),
+            join(root.se, empty, empty, empty));
+}
+
+/// \note PRIVATE
+/// Live cells of node \p id, memoized in \p found; nothing for an empty node
+std::optional<HashLife::NodeBounds>
+HashLife::findBounds(NodeId id, std::unordered_map<NodeId, NodeBounds>& found) const {
+    const auto& node = m_nodes[id];
+    if (node.population == 0) {
+        return std::nullopt;
+    }
+
+    if (node.level == 0) {
+        return NodeBounds{0, 0, 0, 0};
+    }
+
+    if (auto known = found.find(id); known != found.end()) {
+        return known->second;
+    }
+
+    std::optional<NodeBounds> bounds;
+    auto include = [&](NodeId quadrant, std::int64_t offsetX, std::int64_t offsetY) {
+        auto inner = findBounds(quadrant, found);
+        if (!inner.has_value()) {
+            return;
+        }
+
+        NodeBounds shifted{
+                inner->left + offsetX,
+                inner->top + offsetY,
+                inner->right + offsetX,
+                inner->bottom + offsetY};
+        if (!bounds.has_value()) {
+            bounds = shifted;
+            return;
+        }
+
+        bounds->left = std::min(bounds->left, shifted.left);
+        bounds->top = std::min(bounds->top, shifted.top);
+        bounds->right = std::max(bounds->right, shifted.right);
+        bounds->bottom = std::max(bounds->bottom, shifted.bottom);
+    };
+
+    auto half = std::int64_t{1} << (node.level - 1);
+    include(node.nw, 0, 0);
+    include(node.ne, half, 0);
+    include(node.sw, 0, half);
+    include(node.se, half, half);
+
+    found.emplace(id, bounds.value());
+    return bounds;
+}
+
+/// \note PRIVATE
+bool HashLife::fitsInInnerCenter(NodeId id) const {
+    const auto& node = m_nodes[id];
+    if (node.level < MIN_ROOT_LEVEL) {
+        return false;
+    }
+
+    const auto& nw = m_nodes[node.nw];
+    const auto& ne = m_nodes[node.ne];
+    const auto& sw = m_nodes[node.sw];
+    const auto& se = m_nodes[node.se];
+    auto inner = m_nodes[m_nodes[nw.se].se].population + m_nodes[m_nodes[ne.sw].sw].population
+            + m_nodes[m_nodes[sw.ne].ne].population + m_nodes[m_nodes[se.nw].nw].population;
+    return inner == node.population;
+}
+
+/// \note PRIVATE
+void HashLife::growTable() {
+    std::vector<NodeId> table(m_table.size() * 2, NO_NODE);
+    const auto mask = table.size() - 1;
+    for (auto id : m_table) {
+        if (id == NO_NODE) {
+            continue;
+        }
+
+        const auto& node = m_nodes[id];
+        auto slot = hashChildren(node.nw, node.ne, node.sw, node.se) & mask;
+        while (table[slot] != NO_NODE) {
+            slot = (slot + 1) & mask;
+        }
+        table[slot] = id;
+    }
+
+    m_table.swap(table);
+}
+
+/// \note PRIVATE
+/// Returns the canonical node with the given quadrants, creating it on first use
+NodeId HashLife::join(NodeId nw, NodeId ne, NodeId sw, NodeId se) {
+    const auto mask = m_table.size() - 1;
+    auto slot = hashChildren(nw, ne, sw, se) & mask;
+    for (;; slot = (slot + 1) & mask) {
+        auto id = m_table[slot];
+        if (id == NO_NODE) {
+            break;
+        }
+
+        const auto& node = m_nodes[id];
+        if (node.nw == nw && node.ne == ne && node.sw == sw && node.se == se) {
+            return id;
+        }
+    }
+
+    Node node;
+    node.nw = nw;
+    node.ne = ne;
+    node.sw = sw;
+    node.se = se;
+    node.level = m_nodes[nw].level + 1;
+    node.population = m_nodes[nw].population + m_nodes[ne].population + m_nodes[sw].population
+            + m_nodes[se].population;
+
+    NodeId id;
+    if (!m_freeNodes.empty()) {
+        id = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        m_nodes[id] = node;
+    } else {
+        id = static_cast<NodeId>(m_nodes.size());
+        m_nodes.push_back(node);
+    }
+
+    m_table[slot] = id;
+    if (++m_tableCount * 2 > m_table.size()) {
+        growTable();
+    }
+
+    return id;
+}
+
+/// \note PRIVATE
+/// Sets bit x of rows[y] for each live cell (x, y) of node \p id, placed at (left, top)
+void HashLife::leafRows(NodeId id, int left, int top, LeafRows& rows) const {
+    const auto& node = m_nodes[id];
+    if (node.population == 0) {
+        return;
+    }
+
+    if (node.level == 0) {
+        rows[top] |= static_cast<std::uint8_t>(1U << left);
+        return;
+    }
+
+    auto half = 1 << (node.level - 1);
+    leafRows(node.nw, left, top, rows);
+    leafRows(node.ne, left + half, top, rows);
+    leafRows(node.sw, left, top + half, rows);
+    leafRows(node.se, left + half, top + half, rows);
+}
+
+/// \note PRIVATE
+/// Brute-forces one generation of the center 2x2 of a 4x4 node
+NodeId HashLife::life4x4(NodeId id) {
+    const auto& node = m_nodes[id];
+    bool cells[4][4]{};
+    for (auto y = 0; y < 4; ++y) {
+        for (auto x = 0; x < 4; ++x) {
+            const auto& quadrant =
+                    m_nodes[(y < 2) ? (x < 2 ? node.nw : node.ne) : (x < 2 ? node.sw : node.se)];
+            auto leaf = (y % 2 == 0) ? (x % 2 == 0 ? quadrant.nw : quadrant.ne)
+                                     : (x % 2 == 0 ? quadrant.sw : quadrant.se);
+            cells[y][x] = leaf == LIVE_LEAF;
+        }
+    }
+
+    auto nextLeaf = [this, &cells](int x, int y) {
+        auto count = 0;
+        for (auto dy = -1; dy <= 1; ++dy) {
+            for (auto dx = -1; dx <= 1; ++dx) {
+                if ((dx != 0 || dy != 0) && cells[y + dy][x + dx]) {
+                    ++count;
+                }
+            }
+        }
+        return (cells[y][x] ? m_rule.survives(count) : m_rule.isBorn(count)) ? LIVE_LEAF
+                                                                              : DEAD_LEAF;
+    };
+
+    return join(nextLeaf(1, 1), nextLeaf(2, 1), nextLeaf(1, 2), nextLeaf(2, 2));
+}
+
+/// \note PRIVATE
+void HashLife::mark(NodeId id) {
+    std::vector<NodeId> pending{id};
+    while (!pending.empty()) {
+        auto current = pending.back();
+        pending.pop_back();
+
+        auto& node = m_nodes[current];
+        if (node.marked) {
+            continue;
+        }
+
+        node.marked = true;
+        if (node.level > 0) {
+            pending.insert(pending.end(), {node.nw, node.ne, node.sw, node.se});
+        }
+    }
+}
+
+/// \note PRIVATE
+/// Joins one Macrocell line into a node: a leaf of '.', '*' and '$', or "level nw ne sw se"
+/// naming earlier lines; NO_NODE if the line is neither
+/// \note The quadrants of a level 1 node are the states of its cells, as Golly writes them
+NodeId HashLife::parseMacrocellLine(std::string_view line, const std::vector<NodeId>& ids) {
+    if (std::isdigit(static_cast<unsigned char>(line[0])) == 0) {
+        LeafRows rows{};
+        auto col = 0;
+        auto row = 0;
+        for (auto ch : line) {
+            if (ch == MC_EOL) {
+                ++row;
+                col = 0;
+                continue;
+            }
+
+            if (row >= MC_LEAF_SIZE || col >= MC_LEAF_SIZE || (ch != MC_LIVE && ch != MC_DEAD)) {
+                return NO_NODE;
+            }
+            if (ch == MC_LIVE) {
+                rows[row] |= static_cast<std::uint8_t>(1U << col);
+            }
+            ++col;
+        }
+
+        return buildFromLeafRows(rows, MC_LEAF_LEVEL, 0, 0);
+    }
+
+    std::array<std::uint64_t, 5> fields{};
+    if (!parseFields(line, fields) || fields[0] < 1 || fields[0] > MC_MAX_LEVEL) {
+        return NO_NODE;
+    }
+
+    const auto level = static_cast<int>(fields[0]);
+    std::array<NodeId, 4> quadrants{};
+    for (auto i = 0; i < 4; ++i) {
+        const auto index = fields[i + 1];
+        if (level == 1) {
+            if (index > 1) {
+                return NO_NODE;
+            }
+            quadrants[i] = index == 1 ? LIVE_LEAF : DEAD_LEAF;
+        } else if (index == 0) {
+            quadrants[i] = emptyNode(level - 1);
+        } else if (index < ids.size() && m_nodes[ids[index]].level == level - 1) {
+            quadrants[i] = ids[index];
+        } else {
+            return NO_NODE;
+        }
+    }
+
+    return join(quadrants[0], quadrants[1], quadrants[2], quadrants[3]);
+}
+
+/// \note PRIVATE
+void HashLife::renderBits(
+        NodeId id,
+        std::int64_t nodeLeft,
+        std::int64_t nodeTop,
+        const PlaneRect& window,
+        BitGrid& cells) const {
+    const auto& node = m_nodes[id];
+    auto size = std::int64_t{1} << node.level;
+    if (node.population == 0 || nodeLeft >= window.left + window.width
+        || nodeLeft + size <= window.left || nodeTop >= window.top + window.height
+        || nodeTop + size <= window.top) {
+        return;
+    }
+
+    if (node.level == 0) {
+        cells.set(
+                static_cast<int>(nodeLeft - window.left),
+                static_cast<int>(nodeTop - window.top),
+                true);
+        return;
+    }
+
+    auto half = size / 2;
+    renderBits(node.nw, nodeLeft, nodeTop, window, cells);
+    renderBits(node.ne, nodeLeft + half, nodeTop, window, cells);
+    renderBits(node.sw, nodeLeft, nodeTop + half, window, cells);
+    renderBits(node.se, nodeLeft + half, nodeTop + half, window, cells);
+}
+
+/// \note PRIVATE
+void HashLife::renderNode(
+        NodeId id,
+        std::int64_t nodeLeft,
+        std::int64_t nodeTop,
+        std::int64_t left,
+        std::int64_t top,
+        PatternArray& patternArray) const {
+    const auto& node = m_nodes[id];
+    auto size = std::int64_t{1} << node.level;
+    std::int64_t width = patternArray[0].length();
+    std::int64_t height = patternArray.size();
+    if (node.population == 0 || nodeLeft >= left + width || nodeLeft + size <= left
+        || nodeTop >= top + height || nodeTop + size <= top) {
+        return;
+    }
+
+    if (node.level == 0) {
+        patternArray[nodeTop - top][nodeLeft - left] = PTEXT_LIVE;
+        return;
+    }
+
+    auto half = size / 2;
+    renderNode(node.nw, nodeLeft, nodeTop, left, top, patternArray);
+    renderNode(node.ne, nodeLeft + half, nodeTop, left, top, patternArray);
+    renderNode(node.sw, nodeLeft, nodeTop + half, left, top, patternArray);
+    renderNode(node.se, nodeLeft + half, nodeTop + half, left, top, patternArray);
+}
+
+/// \note PRIVATE
+/// Coordinates are relative to the center of node \p id
+NodeId HashLife::setCell(NodeId id, std::int64_t x, std::int64_t y, bool alive) {
+    const auto node = m_nodes[id];
+    if (node.level == 1) {
+        auto leaf = alive ? LIVE_LEAF : DEAD_LEAF;
+        return join(
+                (x < 0 && y < 0) ? leaf : node.nw,
+                (x >= 0 && y < 0) ? leaf : node.ne,
+                (x < 0 && y >= 0) ? leaf : node.sw,
+                (x >= 0 && y >= 0) ? leaf : node.se);
+    }
+
+    auto quarter = std::int64_t{1} << (node.level - 2);
+    auto childX = x + ((x < 0) ? quarter : -quarter);
+    auto childY = y + ((y < 0) ? quarter : -quarter);
+    if (y < 0) {
+        return (x < 0) ? join(setCell(node.nw, childX, childY, alive), node.ne, node.sw, node.se)
+                       : join(node.nw, setCell(node.ne, childX, childY, alive), node.sw, node.se);
+    }
+
+    return (x < 0) ? join(node.nw, node.ne, setCell(node.sw, childX, childY, alive), node.se)
+                   : join(node.nw, node.ne, node.sw, setCell(node.se, childX, childY, alive));
+}
+
+/// \note PRIVATE
+/// Returns the center half of node \p id advanced 2^log2Generations generations, for
+/// log2Generations <= level - 2. At the maximum step both halves of the recursion advance;
+/// below it, the second half only recenters.
+NodeId HashLife::successor(NodeId id, int log2Generations) {
+    const auto node = m_nodes[id];
+    if (node.population == 0) {
+        return emptyNode(node.level - 1);
+    }
+
+    if (node.resultStep == log2Generations && node.result != NO_NODE) {
+        return node.result;
+    }
+
+    NodeId result;
+    if (node.level == 2) {
+        assert(log2Generations == 0);
+        result = life4x4(id);
+    } else {
+        const auto nw = m_nodes[node.nw];
+        const auto ne = m_nodes[node.ne];
+        const auto sw = m_nodes[node.sw];
+        const auto se = m_nodes[node.se];
+
+        NodeId parts[3][3] = {
+                {node.nw, join(nw.ne, ne.nw, nw.se, ne.sw), node.ne},
+                {join(nw.sw, nw.se, sw.nw, sw.ne),
+                 join(nw.se, ne.sw, sw.ne, se.nw),
+                 join(ne.sw, ne.se, se.nw, se.ne)},
+                {node.sw, join(sw.ne, se.nw, sw.se, se.sw), node.se}};
+
+        const bool fullStep = log2Generations == node.level - 2;
+        const auto partStep = fullStep ? log2Generations - 1 : log2Generations;
+        for (auto& row : parts) {
+            for (auto& part : row) {
+                part = successor(part, partStep);
+            }
+        }
+
+        auto quadrant = [&](int row, int col) {
+            auto combined = join(
+                    parts[row][col],
+                    parts[row][col + 1],
+                    parts[row + 1][col],
+                    parts[row + 1][col + 1]);
+            return fullStep ? successor(combined, partStep) : centerOf(combined);
+        };
+
+        result = join(quadrant(0, 0), quadrant(0, 1), quadrant(1, 0), quadrant(1, 1));
+    }
+
+    m_nodes[id].result = result;
+    m_nodes[id].resultStep = static_cast<std::int8_t>(log2Generations);
+    return result;
+}
+
+/// \note PRIVATE
+/// Writes node \p id once its quadrants are written, returning its 1-based line number; 0 for
+/// an empty node, which is never written
+std::uint64_t HashLife::writeMacrocellNode(
+        NodeId id,
+        std::unordered_map<NodeId, std::uint64_t>& indexes,
+        std::uint64_t& nextIndex,
+        std::ostream& out) const {
+    const auto& node = m_nodes[id];
+    if (node.population == 0) {
+        return 0;
+    }
+
+    if (auto known = indexes.find(id); known != indexes.end()) {
+        return known->second;
+    }
+
+    if (node.level == MC_LEAF_LEVEL) {
+        LeafRows rows{};
+        leafRows(id, 0, 0, rows);
+
+        // Trailing dead cells, and trailing empty rows, are left off
+        auto numRows = MC_LEAF_SIZE;
+        while (rows[numRows - 1] == 0) {
+            --numRows;
+        }
+
+        std::string line;
+        for (auto row = 0; row < numRows; ++row) {
+            for (auto bits = static_cast<unsigned int>(rows[row]); bits != 0; bits >>= 1U) {
+                line += (bits & 1U) != 0 ? MC_LIVE : MC_DEAD;
+            }
+            line += MC_EOL;
+        }
+        out << line << '\n';
+    } else {
+        const auto nw = writeMacrocellNode(node.nw, indexes, nextIndex, out);
+        const auto ne = writeMacrocellNode(node.ne, indexes, nextIndex, out);
+        const auto sw = writeMacrocellNode(node.sw, indexes, nextIndex, out);
+        const auto se = writeMacrocellNode(node.se, indexes, nextIndex, out);
+        out << static_cast<int>(node.level) << ' ' << nw << ' ' << ne << ' ' << sw << ' ' << se
+            << '\n';
+    }
+
+    indexes.emplace(id, nextIndex);
+    return nextIndex++;
+}
+}  // namespace gol
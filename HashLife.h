@@ -0,0 +1,175 @@
+/// \file HashLife.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+#include "ConwayDefs.h"
+#include "Rule.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace gol {
+using NodeId = std::uint32_t;
+
+constexpr std::size_t HASHLIFE_MEMORY_MB{512};
+/// Most generations one step() advances: cells spread at most one cell a generation, so a
+/// pattern near (0, 0) stays within reach of 64-bit coordinates
+constexpr std::uint64_t HASHLIFE_MAX_GENERATIONS{std::uint64_t{1} << 58};
+
+/// Rectangle of the plane, by its top left corner in plane coordinates
+struct PlaneRect {
+    std::int64_t left{0};
+    std::int64_t top{0};
+    std::int64_t width{0};
+    std::int64_t height{0};
+};
+
+/// HashLife engine: the plane is a quadtree of canonical (hash-consed) nodes, each node
+/// memoizing the center of its future, so regular patterns advance 2^k generations in time
+/// proportional to their structure rather than their age.
+/// \see https://conwaylife.com/wiki/HashLife
+/// \note Cell (0, 0) is at the center of the root node; x grows rightward and y downward,
+/// matching the columns and rows of a PatternArray placed with its top left corner at (0, 0)
+class HashLife {
+public:
+    explicit HashLife(std::size_t memoryBudget = HASHLIFE_MEMORY_MB << 20);
+    explicit HashLife(
+            const PatternArray& patternArray,
+            std::size_t memoryBudget = HASHLIFE_MEMORY_MB << 20);
+    explicit HashLife(
+            const BitGrid& cells,
+            std::size_t memoryBudget = HASHLIFE_MEMORY_MB << 20);
+
+    void collectGarbage();
+
+    BitGrid getBitGrid(const PlaneRect& window) const;
+    std::optional<PlaneRect> getBounds() const;
+    std::uint64_t getGeneration() const;
+    std::size_t getMemoryUsage() const;
+    std::size_t getNodeCount() const;
+    PatternArray getPatternArray(std::int64_t left, std::int64_t top, int width, int height) const;
+    std::uint64_t getPopulation() const;
+    const Rule& getRule() const;
+
+    bool isAlive(std::int64_t x, std::int64_t y) const;
+    void setCell(std::int64_t x, std::int64_t y, bool alive);
+    void setGeneration(std::uint64_t generation);
+    void setRule(const Rule& rule);
+
+    bool loadMacrocell(std::string_view text);
+    void saveMacrocell(std::ostream& out) const;
+
+    bool step(std::uint64_t generations);
+    bool stepPow2(unsigned int log2Generations);
+
+private:
+    static constexpr NodeId NO_NODE{0xFFFFFFFF};
+    static constexpr NodeId DEAD_LEAF{0};
+    static constexpr NodeId LIVE_LEAF{1};
+
+    ///
+    struct Node {
+        NodeId nw{NO_NODE};
+        NodeId ne{NO_NODE};
+        NodeId sw{NO_NODE};
+        NodeId se{NO_NODE};
+        NodeId result{NO_NODE};
+        std::uint64_t population{0};
+        std::uint8_t level{0};
+        std::int8_t resultStep{-1};
+        bool marked{false};
+    };
+
+    /// Live cells of a node, as offsets from its top left corner
+    struct NodeBounds {
+        std::int64_t left;
+        std::int64_t top;
+        std::int64_t right;
+        std::int64_t bottom;
+    };
+
+    using LeafRows = std::array<std::uint8_t, 8>;
+
+    NodeId buildFromBitGrid(
+            const BitGrid& cells,
+            int level,
+            std::int64_t left,
+            std::int64_t top);
+    NodeId buildFromLeafRows(const LeafRows& rows, int level, int left, int top);
+    NodeId buildFromPattern(
+            const PatternArray& patternArray,
+            std::int64_t extent,
+            int level,
+            std::int64_t left,
+            std::int64_t top);
+    NodeId centerOf(NodeId id);
+    NodeId emptyNode(int level);
+    void expand();
+    std::optional<NodeBounds>
+    findBounds(NodeId id, std::unordered_map<NodeId, NodeBounds>& found) const;
+    bool fitsInInnerCenter(NodeId id) const;
+    void growTable();
+    NodeId join(NodeId nw, NodeId ne, NodeId sw, NodeId se);
+    void leafRows(NodeId id, int left, int top, LeafRows& rows) const;
+    NodeId life4x4(NodeId id);
+    void mark(NodeId id);
+    NodeId parseMacrocellLine(std::string_view line, const std::vector<NodeId>& ids);
+    void renderBits(
+            NodeId id,
+            std::int64_t nodeLeft,
+            std::int64_t nodeTop,
+            const PlaneRect& window,
+            BitGrid& cells) const;
+    void renderNode(
+            NodeId id,
+            std::int64_t nodeLeft,
+            std::int64_t nodeTop,
+            std::int64_t left,
+            std::int64_t top,
+            PatternArray& patternArray) const;
+    NodeId setCell(NodeId id, std::int64_t x, std::int64_t y, bool alive);
+    NodeId successor(NodeId id, int log2Generations);
+    std::uint64_t writeMacrocellNode(
+            NodeId id,
+            std::unordered_map<NodeId, std::uint64_t>& indexes,
+            std::uint64_t& nextIndex,
+            std::ostream& out) const;
+
+    std::vector<Node> m_nodes;
+    std::vector<NodeId> m_freeNodes;
+    std::vector<NodeId> m_table;
+    std::size_t m_tableCount{0};
+    std::vector<NodeId> m_emptyNodes;
+
+    Rule m_rule;
+    NodeId m_root{NO_NODE};
+    std::uint64_t m_generation{0};
+    std::size_t m_memoryBudget{HASHLIFE_MEMORY_MB << 20};
+};
+}  // namespace gol
@@ -0,0 +1,138 @@
+/// \file Headless.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Headless.h"
+
+#include "Checkpoint.h"
+#include "ConwayGrid.h"
+#include "CycleDetector.h"
+#include "SparseGrid.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace gol {
+
+/// Steps \p grid up to \p generations times as fast as it will go, with no display to feed
+/// \note With \p untilStable the run ends early once a generation repeats one of the last
+/// CYCLE_HISTORY, which takes in a pattern that has died out or stopped changing as well as an
+/// oscillating one. Each generation is sampled into \p telemetry, if given
+/// \note With \p dumpEvery, every \p dumpEvery generations are written to
+/// <dumpPrefix>_<generation>.rle; writing is not counted in the elapsed time
+/// \note With \p checkpointEvery, the grid is checkpointed to \p checkpointFile every
+/// \p checkpointEvery generations and once more at the end, written on a thread of its own;
+/// only copying the cells is counted, and the run returns once the last checkpoint is written
+HeadlessReport runHeadless(
+        ConwayGrid& grid,
+        std::uint64_t generations,
+        bool untilStable,
+        Telemetry* telemetry,
+        std::uint64_t dumpEvery,
+        const std::string& dumpPrefix,
+        std::uint64_t checkpointEvery,
+        const std::string& checkpointFile) {
+    HeadlessReport report;
+    auto checkpointer = checkpointEvery > 0 ? std::make_unique<Checkpointer>() : nullptr;
+    CycleDetector cycles(untilStable ? CYCLE_HISTORY : 1);
+    if (untilStable) {
+        grid.trackStateHash();
+        cycles.record(grid.getGeneration(), grid.getStateHash(), grid.getPopulation());
+    }
+    const auto boundedCells = static_cast<std::uint64_t>(grid.getGridWidth())
+            * static_cast<std::uint64_t>(grid.getGridHeight());
+
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    while (report.generations < generations) {
+        const auto stepStart = telemetry != nullptr ? Clock::now() : start;
+        grid.step();
+        ++report.generations;
+        if (telemetry != nullptr) {
+            const std::chrono::duration<float, std::micro> computed = Clock::now() - stepStart;
+            telemetry->record(
+                    {grid.getGeneration(),
+                     computed.count(),
+                     0.0f,
+                     grid.getPopulation(),
+                     grid.getBirths(),
+                     grid.getDeaths()});
+        }
+
+        // An unbounded grid steps every chunk it holds, and nothing else
+        report.cellUpdates += grid.isUnbounded()
+                ? grid.getActiveTileCount() * CHUNK_SIZE * CHUNK_SIZE
+                : boundedCells;
+
+        if (dumpEvery > 0 && grid.getGeneration() % dumpEvery == 0) {
+            const auto dumpStart = Clock::now();
+            grid.writeSnapshot(dumpPrefix);
+            start += Clock::now() - dumpStart;
+        }
+
+        if (checkpointEvery > 0 && grid.getGeneration() % checkpointEvery == 0) {
+            checkpointer->submit(checkpointFile, grid.makeCheckpoint());
+        }
+
+        if (untilStable) {
+            report.cycle =
+                    cycles.record(grid.getGeneration(), grid.getStateHash(), grid.getPopulation());
+            if (report.cycle.has_value()) {
+                break;
+            }
+        }
+    }
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    if (checkpointer) {
+        checkpointer->submit(checkpointFile, grid.makeCheckpoint());
+    }
+
+    report.seconds = elapsed.count();
+    report.population = grid.getPopulation();
+    return report;
+}
+
+///
+void printHeadlessReport(const HeadlessReport& report, std::ostream& out) {
+    const auto perSecond = [&report](double count) {
+        return report.seconds > 0.0 ? count / report.seconds : 0.0;
+    };
+
+    out << "Generations:      " << report.generations;
+    if (report.cycle.has_value() && report.population == 0) {
+        out << " (died out at generation " << report.cycle->onset << ")";
+    } else if (report.cycle.has_value() && report.cycle->period == 1) {
+        out << " (still from generation " << report.cycle->onset << ")";
+    } else if (report.cycle.has_value()) {
+        out << " (period " << report.cycle->period << " from generation " << report.cycle->onset
+            << ")";
+    }
+    out << "\n";
+    out << "Elapsed:          " << report.seconds << " s\n";
+    out << "Throughput:       " << perSecond(static_cast<double>(report.generations))
+        << " generations/s, " << perSecond(static_cast<double>(report.cellUpdates))
+        << " cell updates/s\n";
+    out << "Final population: " << report.population << std::endl;
+}
+}  // namespace gol
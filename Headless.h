@@ -0,0 +1,56 @@
+/// \file Headless.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "ConwayGrid.h"
+#include "CycleDetector.h"
+#include "Telemetry.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+
+namespace gol {
+
+/// What a headless run did, and how fast
+struct HeadlessReport {
+    std::uint64_t generations{0};
+    /// Cells recomputed or skipped over all generations; a bounded grid counts every cell
+    std::uint64_t cellUpdates{0};
+    double seconds{0.0};
+    std::uint64_t population{0};
+    /// Where the run settled into a cycle, if it was asked to stop there and did
+    std::optional<Cycle> cycle;
+};
+
+HeadlessReport runHeadless(
+        ConwayGrid& grid,
+        std::uint64_t generations,
+        bool untilStable,
+        Telemetry* telemetry = nullptr,
+        std::uint64_t dumpEvery = 0,
+        const std::string& dumpPrefix = "snapshot",
+        std::uint64_t checkpointEvery = 0,
+        const std::string& checkpointFile = "snapshot.ckpt");
+void printHeadlessReport(const HeadlessReport& report, std::ostream& out);
+}  // namespace gol
@@ -0,0 +1,149 @@
+/// \file LifeKernel.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "LifeKernel.h"
+
+#include "BitGrid.h"
+#include "LifeKernelImpl.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <optional>
+#include <string>
+
+namespace gol {
+namespace {
+struct ScalarIsa {};
+
+/// \note __builtin_cpu_supports reads CPUID (and XGETBV for the AVX state) once at startup
+bool cpuSupports(KernelType kernel) {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    switch (kernel) {
+    case KernelType::SSE2:
+        return __builtin_cpu_supports("sse2");
+    case KernelType::AVX2:
+        return __builtin_cpu_supports("avx2");
+    default:
+        return true;
+    }
+#else
+    return kernel == KernelType::SCALAR || kernel == KernelType::AUTO;
+#endif
+}
+}  // namespace
+
+///
+bool isKernelSupported(KernelType kernel) {
+    switch (kernel) {
+    case KernelType::SSE2:
+        return hasSSE2Kernel() && cpuSupports(kernel);
+    case KernelType::AVX2:
+        return hasAVX2Kernel() && cpuSupports(kernel);
+    default:
+        return true;
+    }
+}
+
+///
+std::string kernelName(KernelType kernel) {
+    switch (kernel) {
+    case KernelType::SCALAR:
+        return "scalar";
+    case KernelType::SSE2:
+        return "sse2";
+    case KernelType::AVX2:
+        return "avx2";
+    default:
+        return "auto";
+    }
+}
+
+///
+std::optional<KernelType> parseKernelType(const std::string& name) {
+    std::string lowered(name);
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+
+    for (auto kernel : {KernelType::AUTO, KernelType::SCALAR, KernelType::SSE2, KernelType::AVX2}) {
+        if (lowered == kernelName(kernel)) {
+            return kernel;
+        }
+    }
+
+    return std::nullopt;
+}
+
+/// \note AUTO picks the widest supported kernel; an unsupported request falls back the same way
+KernelType resolveKernel(KernelType requested) {
+    if (requested != KernelType::AUTO) {
+        if (isKernelSupported(requested)) {
+            return requested;
+        }
+        std::clog << "The " << kernelName(requested)
+                  << " kernel is not supported on this CPU, choosing another" << std::endl;
+    }
+
+    for (auto kernel : {KernelType::AVX2, KernelType::SSE2}) {
+        if (isKernelSupported(kernel)) {
+            return kernel;
+        }
+    }
+
+    return KernelType::SCALAR;
+}
+
+///
+void stepRows(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        int rowBegin,
+        int rowEnd,
+        const Rule& rule,
+        KernelType kernel) {
+    KernelSpan span{rowBegin, rowEnd, 0, current.getWordsPerRow()};
+    stepSpan(current, next, choked, span, nullptr, nullptr, rule, kernel);
+}
+
+///
+void stepSpan(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule,
+        KernelType kernel) {
+    switch (kernel) {
+    case KernelType::AVX2:
+        stepSpanAVX2(current, next, choked, span, changes, counts, rule);
+        break;
+    case KernelType::SSE2:
+        stepSpanSSE2(current, next, choked, span, changes, counts, rule);
+        break;
+    default:
+        stepSpanWith<ScalarLane<ScalarIsa>>(current, next, choked, span, changes, counts, rule);
+        break;
+    }
+}
+}  // namespace gol
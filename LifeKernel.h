@@ -0,0 +1,78 @@
+/// \file LifeKernel.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+#include "Rule.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace gol {
+enum class KernelType { AUTO, SCALAR, SSE2, AVX2 };
+
+bool isKernelSupported(KernelType kernel);
+std::string kernelName(KernelType kernel);
+std::optional<KernelType> parseKernelType(const std::string& name);
+KernelType resolveKernel(KernelType requested);
+
+/// A block of a BitGrid: rows [rowBegin, rowEnd) across words [wordBegin, wordEnd)
+struct KernelSpan {
+    int rowBegin{0};
+    int rowEnd{0};
+    int wordBegin{0};
+    int wordEnd{0};
+};
+
+/// Cells born and cells that died over the spans stepped with it
+struct TransitionCounts {
+    std::uint64_t births{0};
+    std::uint64_t deaths{0};
+};
+
+/// Advances rows [rowBegin, rowEnd) of \p current by one generation of \p rule into \p next,
+/// marking every cell with four or more live neighbors in \p choked.
+/// \note The halo of \p current must have been filled beforehand
+void stepRows(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        int rowBegin,
+        int rowEnd,
+        const Rule& rule,
+        KernelType kernel = KernelType::SCALAR);
+
+/// Advances the block \p span of \p current like stepRows(); when \p changes is given, ORs
+/// the cells of each word that changed into changes[word], and when \p counts is given, adds
+/// the span's births and deaths to it
+/// \note Rows outside the span read from \p current but are left untouched in \p next
+void stepSpan(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule,
+        KernelType kernel = KernelType::SCALAR);
+}  // namespace gol
@@ -0,0 +1,122 @@
+/// \file LifeKernelAVX2.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "BitGrid.h"
+#include "LifeKernel.h"
+#include "LifeKernelImpl.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+namespace gol {
+namespace {
+/// Four 64-bit words, 256 cells, as a lane
+struct Avx2Lane {
+    static constexpr int WORDS{4};
+
+    static Avx2Lane load(const BitWord* words) {
+        return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(words))};
+    }
+
+    static Avx2Lane fill(BitWord word) {
+        return {_mm256_set1_epi64x(static_cast<long long>(word))};
+    }
+
+    void store(BitWord* words) const {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(words), m_lanes);
+    }
+
+    Avx2Lane shiftedLeft() const {
+        return {_mm256_slli_epi64(m_lanes, 1)};
+    }
+
+    Avx2Lane topBitToBottom() const {
+        return {_mm256_srli_epi64(m_lanes, BITS_PER_WORD - 1)};
+    }
+
+    Avx2Lane shiftedRight() const {
+        return {_mm256_srli_epi64(m_lanes, 1)};
+    }
+
+    Avx2Lane bottomBitToTop() const {
+        return {_mm256_slli_epi64(m_lanes, BITS_PER_WORD - 1)};
+    }
+
+    Avx2Lane andNot(Avx2Lane rhs) const {
+        return {_mm256_andnot_si256(rhs.m_lanes, m_lanes)};
+    }
+
+    friend Avx2Lane operator&(Avx2Lane lhs, Avx2Lane rhs) {
+        return {_mm256_and_si256(lhs.m_lanes, rhs.m_lanes)};
+    }
+
+    friend Avx2Lane operator|(Avx2Lane lhs, Avx2Lane rhs) {
+        return {_mm256_or_si256(lhs.m_lanes, rhs.m_lanes)};
+    }
+
+    friend Avx2Lane operator^(Avx2Lane lhs, Avx2Lane rhs) {
+        return {_mm256_xor_si256(lhs.m_lanes, rhs.m_lanes)};
+    }
+
+    __m256i m_lanes;
+};
+}  // namespace
+
+///
+void stepSpanAVX2(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule) {
+    stepSpanWith<Avx2Lane>(current, next, choked, span, changes, counts, rule);
+}
+
+///
+bool hasAVX2Kernel() {
+    return true;
+}
+}  // namespace gol
+
+#else
+
+namespace gol {
+/// \note Not built for AVX2, so never selected; isKernelSupported() reports it unavailable
+void stepSpanAVX2(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule) {
+    stepSpan(current, next, choked, span, changes, counts, rule, KernelType::SCALAR);
+}
+
+///
+bool hasAVX2Kernel() {
+    return false;
+}
+}  // namespace gol
+#endif
@@ -0,0 +1,305 @@
+/// \file LifeKernelImpl.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+#include "LifeKernel.h"
+#include "Rule.h"
+
+#include <bit>
+
+namespace gol {
+void stepSpanSSE2(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule);
+void stepSpanAVX2(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule);
+bool hasSSE2Kernel();
+bool hasAVX2Kernel();
+
+/// One 64-bit word as a lane of cells
+/// \note Each kernel translation unit is compiled for its own instruction set, so the scalar
+/// lane is parameterized by the lane it finishes rows for; that keeps every unit's
+/// instantiations distinct, and the linker can never pair an AVX2 copy with the scalar path
+template<typename Owner>
+struct ScalarLane {
+    static constexpr int WORDS{1};
+
+    static ScalarLane load(const BitWord* words) {
+        return {*words};
+    }
+
+    static ScalarLane fill(BitWord word) {
+        return {word};
+    }
+
+    void store(BitWord* words) const {
+        *words = m_word;
+    }
+
+    ScalarLane shiftedLeft() const {
+        return {m_word << 1};
+    }
+
+    ScalarLane topBitToBottom() const {
+        return {m_word >> (BITS_PER_WORD - 1)};
+    }
+
+    ScalarLane shiftedRight() const {
+        return {m_word >> 1};
+    }
+
+    ScalarLane bottomBitToTop() const {
+        return {m_word << (BITS_PER_WORD - 1)};
+    }
+
+    ScalarLane andNot(ScalarLane rhs) const {
+        return {m_word & ~rhs.m_word};
+    }
+
+    friend ScalarLane operator&(ScalarLane lhs, ScalarLane rhs) {
+        return {lhs.m_word & rhs.m_word};
+    }
+
+    friend ScalarLane operator|(ScalarLane lhs, ScalarLane rhs) {
+        return {lhs.m_word | rhs.m_word};
+    }
+
+    friend ScalarLane operator^(ScalarLane lhs, ScalarLane rhs) {
+        return {lhs.m_word ^ rhs.m_word};
+    }
+
+    BitWord m_word;
+};
+
+/// Cells to the west of each cell in the lane at \p words
+template<typename Lane>
+inline Lane westOf(const BitWord* words) {
+    return Lane::load(words).shiftedLeft() | Lane::load(words - 1).topBitToBottom();
+}
+
+/// Cells to the east of each cell in the lane at \p words
+template<typename Lane>
+inline Lane eastOf(const BitWord* words) {
+    return Lane::load(words).shiftedRight() | Lane::load(words + 1).bottomBitToTop();
+}
+
+/// \note Bit-sliced neighbor count: each row of three is summed into a two-bit count, and the
+/// three row counts are folded with full adders, so a whole lane resolves in a few dozen ops
+template<typename Lane>
+inline void lifeLane(
+        const BitWord* above,
+        const BitWord* middle,
+        const BitWord* below,
+        BitWord* next,
+        BitWord* choked) {
+    const auto nw = westOf<Lane>(above);
+    const auto n = Lane::load(above);
+    const auto ne = eastOf<Lane>(above);
+    const auto w = westOf<Lane>(middle);
+    const auto alive = Lane::load(middle);
+    const auto e = eastOf<Lane>(middle);
+    const auto sw = westOf<Lane>(below);
+    const auto s = Lane::load(below);
+    const auto se = eastOf<Lane>(below);
+
+    // Per-row sums: top and bottom 0..3, middle 0..2, as (ones, twos)
+    const auto topOnes = nw ^ n ^ ne;
+    const auto topTwos = (nw & n) | (ne & (nw ^ n));
+    const auto botOnes = sw ^ s ^ se;
+    const auto botTwos = (sw & s) | (se & (sw ^ s));
+    const auto midOnes = w ^ e;
+    const auto midTwos = w & e;
+
+    // count = ones + 2 * (topTwos + botTwos + midTwos + carry)
+    const auto ones = topOnes ^ botOnes ^ midOnes;
+    const auto carry = (topOnes & botOnes) | (midOnes & (topOnes ^ botOnes));
+    const auto pairA = topTwos ^ botTwos;
+    const auto pairB = midTwos ^ carry;
+    const auto twos = pairA ^ pairB;
+    const auto fourPlus = (topTwos & botTwos) | (midTwos & carry) | (pairA & pairB);
+
+    (twos.andNot(fourPlus) & (ones | alive)).store(next);
+    fourPlus.store(choked);
+}
+
+/// Any outer-totalistic rule: the neighbor count is summed in full, as four bit planes, then
+/// every count is matched against the rule's birth and survival masks
+/// \note Every lane does the same work whatever the rule, so no cell ever branches on it
+template<typename Lane>
+inline void ruleLane(
+        const BitWord* above,
+        const BitWord* middle,
+        const BitWord* below,
+        BitWord* next,
+        BitWord* choked,
+        const RuleTable& table) {
+    const auto nw = westOf<Lane>(above);
+    const auto n = Lane::load(above);
+    const auto ne = eastOf<Lane>(above);
+    const auto w = westOf<Lane>(middle);
+    const auto alive = Lane::load(middle);
+    const auto e = eastOf<Lane>(middle);
+    const auto sw = westOf<Lane>(below);
+    const auto s = Lane::load(below);
+    const auto se = eastOf<Lane>(below);
+
+    const auto topOnes = nw ^ n ^ ne;
+    const auto topTwos = (nw & n) | (ne & (nw ^ n));
+    const auto botOnes = sw ^ s ^ se;
+    const auto botTwos = (sw & s) | (se & (sw ^ s));
+    const auto midOnes = w ^ e;
+    const auto midTwos = w & e;
+
+    // As in lifeLane, but the twos are carried on into fours and eights: at most one of the
+    // three pair carries is set unless all four twos are, which only a count of eight makes
+    const auto ones = topOnes ^ botOnes ^ midOnes;
+    const auto carry = (topOnes & botOnes) | (midOnes & (topOnes ^ botOnes));
+    const auto pairA = topTwos ^ botTwos;
+    const auto pairB = midTwos ^ carry;
+    const auto twos = pairA ^ pairB;
+    const auto carryA = topTwos & botTwos;
+    const auto carryB = midTwos & carry;
+    const auto carryAB = pairA & pairB;
+    const auto fours = carryA ^ carryB ^ carryAB;
+    const auto eights = carryA & carryB;
+
+    const auto all = Lane::fill(~BitWord{0});
+    const Lane lowBits[4]{
+            all.andNot(ones | twos), ones.andNot(twos), twos.andNot(ones), ones & twos};
+    const auto noHighBits = all.andNot(fours | eights);
+
+    auto born = eights & Lane::fill(table[8]);
+    auto survived = eights & Lane::fill(table[NEIGHBOR_COUNTS + 8]);
+    for (auto count = 0; count < 8; ++count) {
+        const auto matches = lowBits[count % 4] & (count < 4 ? noHighBits : fours);
+        born = born | (matches & Lane::fill(table[count]));
+        survived = survived | (matches & Lane::fill(table[NEIGHBOR_COUNTS + count]));
+    }
+
+    ((alive & survived) | born.andNot(alive)).store(next);
+    (fours | eights).store(choked);
+}
+
+/// One lane under Conway's rule or, when \p IS_CONWAY is false, under the rule \p table
+template<typename Lane, bool IS_CONWAY>
+inline void stepLane(
+        const BitWord* above,
+        const BitWord* middle,
+        const BitWord* below,
+        BitWord* next,
+        BitWord* choked,
+        const RuleTable& table) {
+    if constexpr (IS_CONWAY) {
+        lifeLane<Lane>(above, middle, below, next, choked);
+    } else {
+        ruleLane<Lane>(above, middle, below, next, choked, table);
+    }
+}
+
+/// Steps whole lanes across each row of the span, finishing the remainder a word at a time
+/// \note Births and deaths are counted row by row while the row is still in cache; the AVX2
+/// unit is built for a CPU that has POPCNT, the others may fall back on a library call
+template<typename Lane, bool IS_CONWAY>
+inline void stepSpanRows(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const RuleTable& table) {
+    const auto numWords = current.getWordsPerRow();
+    const auto lastWordMask = current.getLastWordMask();
+    const auto endsRow = span.wordEnd == numWords;
+
+    for (auto row = span.rowBegin; row < span.rowEnd; ++row) {
+        const auto* above = current.rowWords(row - 1);
+        const auto* middle = current.rowWords(row);
+        const auto* below = current.rowWords(row + 1);
+        auto* nextRow = next.rowWords(row);
+        auto* chokedRow = choked.rowWords(row);
+
+        auto i = span.wordBegin;
+        for (; i + Lane::WORDS <= span.wordEnd; i += Lane::WORDS) {
+            stepLane<Lane, IS_CONWAY>(
+                    above + i, middle + i, below + i, nextRow + i, chokedRow + i, table);
+        }
+        for (; i < span.wordEnd; ++i) {
+            stepLane<ScalarLane<Lane>, IS_CONWAY>(
+                    above + i, middle + i, below + i, nextRow + i, chokedRow + i, table);
+        }
+
+        if (endsRow) {
+            nextRow[numWords - 1] &= lastWordMask;
+            chokedRow[numWords - 1] &= lastWordMask;
+        }
+
+        if (changes != nullptr) {
+            for (i = span.wordBegin; i < span.wordEnd; ++i) {
+                changes[i] |= nextRow[i] ^ middle[i];
+            }
+            if (endsRow) {
+                // The east halo bit of a wrapped grid is not a cell
+                changes[numWords - 1] &= lastWordMask;
+            }
+        }
+
+        if (counts != nullptr) {
+            for (i = span.wordBegin; i < span.wordEnd; ++i) {
+                const auto was = (endsRow && i == numWords - 1) ? middle[i] & lastWordMask
+                                                                 : middle[i];
+                counts->births += std::popcount(nextRow[i] & ~was);
+                counts->deaths += std::popcount(was & ~nextRow[i]);
+            }
+        }
+    }
+}
+
+/// \note The rule is settled once per span, so the kernel loops never test it
+template<typename Lane>
+inline void stepSpanWith(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule) {
+    if (rule.isConway()) {
+        stepSpanRows<Lane, true>(current, next, choked, span, changes, counts, rule.getTable());
+    } else {
+        stepSpanRows<Lane, false>(current, next, choked, span, changes, counts, rule.getTable());
+    }
+}
+}  // namespace gol
@@ -0,0 +1,122 @@
+/// \file LifeKernelSSE2.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "BitGrid.h"
+#include "LifeKernel.h"
+#include "LifeKernelImpl.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+
+namespace gol {
+namespace {
+/// Two 64-bit words, 128 cells, as a lane
+struct Sse2Lane {
+    static constexpr int WORDS{2};
+
+    static Sse2Lane load(const BitWord* words) {
+        return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(words))};
+    }
+
+    static Sse2Lane fill(BitWord word) {
+        return {_mm_set1_epi64x(static_cast<long long>(word))};
+    }
+
+    void store(BitWord* words) const {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(words), m_lanes);
+    }
+
+    Sse2Lane shiftedLeft() const {
+        return {_mm_slli_epi64(m_lanes, 1)};
+    }
+
+    Sse2Lane topBitToBottom() const {
+        return {_mm_srli_epi64(m_lanes, BITS_PER_WORD - 1)};
+    }
+
+    Sse2Lane shiftedRight() const {
+        return {_mm_srli_epi64(m_lanes, 1)};
+    }
+
+    Sse2Lane bottomBitToTop() const {
+        return {_mm_slli_epi64(m_lanes, BITS_PER_WORD - 1)};
+    }
+
+    Sse2Lane andNot(Sse2Lane rhs) const {
+        return {_mm_andnot_si128(rhs.m_lanes, m_lanes)};
+    }
+
+    friend Sse2Lane operator&(Sse2Lane lhs, Sse2Lane rhs) {
+        return {_mm_and_si128(lhs.m_lanes, rhs.m_lanes)};
+    }
+
+    friend Sse2Lane operator|(Sse2Lane lhs, Sse2Lane rhs) {
+        return {_mm_or_si128(lhs.m_lanes, rhs.m_lanes)};
+    }
+
+    friend Sse2Lane operator^(Sse2Lane lhs, Sse2Lane rhs) {
+        return {_mm_xor_si128(lhs.m_lanes, rhs.m_lanes)};
+    }
+
+    __m128i m_lanes;
+};
+}  // namespace
+
+///
+void stepSpanSSE2(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule) {
+    stepSpanWith<Sse2Lane>(current, next, choked, span, changes, counts, rule);
+}
+
+///
+bool hasSSE2Kernel() {
+    return true;
+}
+}  // namespace gol
+
+#else
+
+namespace gol {
+/// \note Not built for SSE2, so never selected; isKernelSupported() reports it unavailable
+void stepSpanSSE2(
+        const BitGrid& current,
+        BitGrid& next,
+        BitGrid& choked,
+        const KernelSpan& span,
+        BitWord* changes,
+        TransitionCounts* counts,
+        const Rule& rule) {
+    stepSpan(current, next, choked, span, changes, counts, rule, KernelType::SCALAR);
+}
+
+///
+bool hasSSE2Kernel() {
+    return false;
+}
+}  // namespace gol
+#endif
@@ -0,0 +1,95 @@
+/// \file MappedFile.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "MappedFile.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GOL_HAS_MMAP 1
+#endif
+
+namespace gol {
+
+/// \note The descriptor is closed as soon as the file is mapped; the mapping keeps it alive
+MappedFile::MappedFile(const std::string& filename) {
+#ifdef GOL_HAS_MMAP
+    auto fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat status {};
+        if (::fstat(fd, &status) == 0 && status.st_size > 0) {
+            m_size = static_cast<std::size_t>(status.st_size);
+            auto* mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                // Parsers read front to back, so let the kernel read ahead aggressively
+                ::madvise(mapping, m_size, MADV_SEQUENTIAL);
+                m_data = static_cast<const char*>(mapping);
+                m_mapped = true;
+            }
+        }
+        ::close(fd);
+    }
+
+    if (m_mapped) {
+        return;
+    }
+#endif
+
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        std::cerr << "Couldn't open " << filename << std::endl;
+        m_size = 0;
+        return;
+    }
+
+    m_buffer.assign(std::istreambuf_iterator<char>{file}, {});
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+}
+
+///
+MappedFile::~MappedFile() {
+#ifdef GOL_HAS_MMAP
+    if (m_mapped) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+}
+
+///
+bool MappedFile::isOpen() const {
+    return m_data != nullptr;
+}
+
+///
+std::string_view MappedFile::view() const {
+    return {m_data, m_size};
+}
+}  // namespace gol
@@ -24,40 +24,43 @@
 
 namespace gol {
 
+namespace {
+///
+template<Topology T>
+NeighborArray neighborhoodOf(int col, int row, int gridWidth, int gridHeight) {
+    NeighborArray neighbors;
+    neighbors.reserve(8);  // Preallocate for 8 neighbors
+    forEachNeighbor<T>(col, row, gridWidth, gridHeight, [&neighbors](int nextCol, int nextRow) {
+        neighbors.emplace_back(nextCol, nextRow);
+    });
+
+    return neighbors;
+}
+}  // namespace
+
 /// \note Moore Neighborhood implementation
 /// \see https://en.wikipedia.org/wiki/Moore_neighborhood
 NeighborArray mooreNeighborhood(int col, int row, int gridWidth, int gridHeight, bool wrapped) {
-    NeighborArray neighbors;
-    neighbors.reserve(8);  // Preallocate for 8 neighbors
+    return mooreNeighborhood(
+            col,
+            row,
+            gridWidth,
+            gridHeight,
+            wrapped ? Topology::TORUS : Topology::BOUNDED);
+}
 
-    if (wrapped) {
-        // Wrapped grid: all 8 neighbors always valid
-        for (auto dCol = -1; dCol <= 1; ++dCol) {
-            for (auto dRow = -1; dRow <= 1; ++dRow) {
-                if (dCol != 0 || dRow != 0) {
-                    // Proper modulo for negative numbers
-                    auto neighborCol = ((col + dCol) % gridWidth + gridWidth) % gridWidth;
-                    auto neighborRow = ((row + dRow) % gridHeight + gridHeight) % gridHeight;
-                    neighbors.emplace_back(neighborCol, neighborRow);
-                }
-            }
-        }
-    } else {
-        // Bounded grid: check bounds
-        for (auto dCol = -1; dCol <= 1; ++dCol) {
-            for (auto dRow = -1; dRow <= 1; ++dRow) {
-                if (dCol != 0 || dRow != 0) {
-                    auto neighborCol = col + dCol;
-                    auto neighborRow = row + dRow;
-                    if (neighborCol >= 0 && neighborCol < gridWidth && neighborRow >= 0
-                        && neighborRow < gridHeight) {
-                        neighbors.emplace_back(neighborCol, neighborRow);
-                    }
-                }
-            }
-        }
+/// \note Dispatches on the topology once per cell rather than once per neighbor
+NeighborArray
+mooreNeighborhood(int col, int row, int gridWidth, int gridHeight, Topology topology) {
+    switch (topology) {
+    case Topology::TORUS:
+        return neighborhoodOf<Topology::TORUS>(col, row, gridWidth, gridHeight);
+    case Topology::KLEIN_BOTTLE:
+        return neighborhoodOf<Topology::KLEIN_BOTTLE>(col, row, gridWidth, gridHeight);
+    case Topology::CROSS_SURFACE:
+        return neighborhoodOf<Topology::CROSS_SURFACE>(col, row, gridWidth, gridHeight);
+    default:
+        return neighborhoodOf<Topology::BOUNDED>(col, row, gridWidth, gridHeight);
     }
-
-    return neighbors;
 }
 }  // namespace gol
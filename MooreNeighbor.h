@@ -21,11 +21,62 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 #pragma once
+#include "Topology.h"
+
 #include <vector>
 
 namespace gol {
 using NeighborArray = std::vector<std::pair<int, int>>;
 
+/// Calls \p visit with the column and row of each neighbor of (col, row), in the order
+/// mooreNeighborhood() lists them, without building the list
+/// \note Cells clear of every edge take the plain offsets; only the border maps its
+/// neighbors through the topology
+template<Topology T, typename Visit>
+void forEachNeighbor(int col, int row, int gridWidth, int gridHeight, Visit&& visit) {
+    const bool isInterior = col > 0 && col < gridWidth - 1 && row > 0 && row < gridHeight - 1;
+    for (auto dCol = -1; dCol <= 1; ++dCol) {
+        for (auto dRow = -1; dRow <= 1; ++dRow) {
+            if (dCol == 0 && dRow == 0) {
+                continue;
+            }
+
+            auto neighborCol = col + dCol;
+            auto neighborRow = row + dRow;
+            if (isInterior || mapOntoGrid<T>(neighborCol, neighborRow, gridWidth, gridHeight)) {
+                visit(neighborCol, neighborRow);
+            }
+        }
+    }
+}
+
+/// \note Dispatches on the topology once per cell rather than once per neighbor
+template<typename Visit>
+void forEachNeighbor(
+        int col,
+        int row,
+        int gridWidth,
+        int gridHeight,
+        Topology topology,
+        Visit&& visit) {
+    switch (topology) {
+    case Topology::TORUS:
+        forEachNeighbor<Topology::TORUS>(col, row, gridWidth, gridHeight, visit);
+        break;
+    case Topology::KLEIN_BOTTLE:
+        forEachNeighbor<Topology::KLEIN_BOTTLE>(col, row, gridWidth, gridHeight, visit);
+        break;
+    case Topology::CROSS_SURFACE:
+        forEachNeighbor<Topology::CROSS_SURFACE>(col, row, gridWidth, gridHeight, visit);
+        break;
+    default:
+        forEachNeighbor<Topology::BOUNDED>(col, row, gridWidth, gridHeight, visit);
+        break;
+    }
+}
+
 NeighborArray
 mooreNeighborhood(int col, int row, int gridWidth, int gridHeight, bool wrapped = false);
+NeighborArray
+mooreNeighborhood(int col, int row, int gridWidth, int gridHeight, Topology topology);
 }  // namespace gol
\ No newline at end of file
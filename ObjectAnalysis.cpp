@@ -0,0 +1,495 @@
+/// \file ObjectAnalysis.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "ObjectAnalysis.h"
+
+#include "ConwayGrid.h"
+#include "SparseGrid.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gol {
+namespace {
+/// Furthest apart, in rows or columns, two live cells of one object may be: cells two apart
+/// still share dead neighbors, so births between them can tie them together
+constexpr int INTERACTION_RADIUS{2};
+/// Cells one apart touch, even at a corner
+constexpr int TOUCHING_RADIUS{1};
+
+/// Live cells [begin, end) of one row
+struct CellRun {
+    int row{0};
+    int begin{0};
+    int end{0};
+};
+
+/// Every run of live cells in \p cells, row by row, left to right
+/// \note Reads whole words, so empty stretches of a row cost one test per 64 cells
+std::vector<CellRun> findRuns(const BitGrid& cells) {
+    const auto width = cells.getWidth();
+    const auto lastWord = cells.getWordsPerRow() - 1;
+    std::vector<CellRun> runs;
+
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        const auto* words = cells.rowWords(row);
+        const auto wordAt = [&](int word) {
+            return word == lastWord ? words[word] & cells.getLastWordMask() : words[word];
+        };
+
+        auto col = 0;
+        while (col < width) {
+            auto word = col / BITS_PER_WORD;
+            auto bits = wordAt(word) & (~BitWord{0} << (col % BITS_PER_WORD));
+            while (bits == 0 && word < lastWord) {
+                bits = wordAt(++word);
+            }
+            if (bits == 0) {
+                break;
+            }
+            const auto begin = word * BITS_PER_WORD + std::countr_zero(bits);
+
+            bits = ~wordAt(word) & (~BitWord{0} << (begin % BITS_PER_WORD));
+            while (bits == 0 && word < lastWord) {
+                bits = ~wordAt(++word);
+            }
+            const auto end = bits == 0
+                    ? width
+                    : std::min(word * BITS_PER_WORD + std::countr_zero(bits), width);
+            runs.push_back({row, begin, end});
+            col = end;
+        }
+    }
+
+    return runs;
+}
+
+/// Union-find root of \p run, halving the path on the way
+std::size_t findRoot(std::vector<std::size_t>& parents, std::size_t run) {
+    while (parents[run] != run) {
+        parents[run] = parents[parents[run]];
+        run = parents[run];
+    }
+
+    return run;
+}
+
+/// Groups \p runs so that runs with cells no more than \p radius rows and columns apart share
+/// a root, and returns each run's root
+std::vector<std::size_t> groupRuns(const std::vector<CellRun>& runs, int radius) {
+    std::vector<std::size_t> parents(runs.size());
+    std::iota(parents.begin(), parents.end(), std::size_t{0});
+    const auto join = [&parents](std::size_t lhs, std::size_t rhs) {
+        lhs = findRoot(parents, lhs);
+        rhs = findRoot(parents, rhs);
+        if (lhs != rhs) {
+            parents[std::max(lhs, rhs)] = std::min(lhs, rhs);
+        }
+    };
+
+    // First run of each row so far, and for each the first of its runs a later run of the
+    // current row could still reach; runs only move right along a row, so neither moves back
+    std::vector<std::size_t> rowStarts;
+    std::vector<std::size_t> cursors;
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        const auto& current = runs[run];
+        if (run == 0 || current.row != runs[run - 1].row) {
+            rowStarts.push_back(run);
+            cursors.push_back(run);
+            for (auto back = rowStarts.size() - 1; back-- > 0;) {
+                if (current.row - runs[rowStarts[back]].row > radius) {
+                    break;
+                }
+                cursors[back] = rowStarts[back];
+            }
+        } else if (current.begin - runs[run - 1].end < radius) {
+            join(run - 1, run);
+        }
+
+        for (auto back = rowStarts.size() - 1; back-- > 0;) {
+            const auto otherRow = runs[rowStarts[back]].row;
+            if (current.row - otherRow > radius) {
+                break;
+            }
+            auto& other = cursors[back];
+            while (other < runs.size() && runs[other].row == otherRow
+                    && runs[other].end + radius <= current.begin) {
+                ++other;
+            }
+            for (auto reach = other; reach < runs.size() && runs[reach].row == otherRow; ++reach) {
+                if (runs[reach].begin >= current.end + radius) {
+                    break;
+                }
+                join(reach, run);
+            }
+        }
+    }
+
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        parents[run] = findRoot(parents, run);
+    }
+
+    return parents;
+}
+
+/// The groups of \p runs sharing a root in \p roots, each cropped to its bounds, in the order
+/// of their first runs; runs \p wanted turns down are left out, and \p objectOf is set to the
+/// index of the object each run kept went to
+/// \note Relies on groupRuns() rooting each group at its first run
+template<typename Wanted>
+std::vector<FoundObject> collectObjects(
+        const std::vector<CellRun>& runs,
+        const std::vector<std::size_t>& roots,
+        std::vector<std::size_t>& objectOf,
+        Wanted wanted) {
+    std::vector<FoundObject> objects;
+    // Right and bottom edges, exclusive, while the bounds are gathered
+    std::vector<std::pair<int, int>> farEdges;
+    objectOf.resize(runs.size());
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        if (!wanted(run)) {
+            continue;
+        }
+        if (roots[run] == run) {
+            objectOf[run] = objects.size();
+            objects.push_back({BitGrid(), runs[run].begin, runs[run].row, {}});
+            farEdges.emplace_back(runs[run].end, runs[run].row + 1);
+            continue;
+        }
+        objectOf[run] = objectOf[roots[run]];
+        auto& object = objects[objectOf[run]];
+        auto& [right, bottom] = farEdges[objectOf[run]];
+        object.left = std::min(object.left, runs[run].begin);
+        right = std::max(right, runs[run].end);
+        bottom = runs[run].row + 1;
+    }
+
+    for (std::size_t index = 0; index < objects.size(); ++index) {
+        auto& object = objects[index];
+        object.cells = BitGrid(
+                farEdges[index].first - object.left, farEdges[index].second - object.top);
+    }
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        if (wanted(run)) {
+            auto& object = objects[objectOf[run]];
+            object.cells.setRun(
+                    runs[run].begin - object.left,
+                    runs[run].row - object.top,
+                    runs[run].end - runs[run].begin);
+        }
+    }
+
+    return objects;
+}
+
+/// One of the eight rotations and reflections of \p cells: bit 0 of \p orientation flips it
+/// left to right, bit 1 top to bottom, and bit 2 swaps rows for columns
+BitGrid orient(const BitGrid& cells, int orientation) {
+    const auto transpose = (orientation & 4) != 0;
+    const auto width = transpose ? cells.getHeight() : cells.getWidth();
+    const auto height = transpose ? cells.getWidth() : cells.getHeight();
+    BitGrid oriented(width, height);
+    for (auto row = 0; row < height; ++row) {
+        for (auto col = 0; col < width; ++col) {
+            auto fromCol = (orientation & 1) != 0 ? width - 1 - col : col;
+            auto fromRow = (orientation & 2) != 0 ? height - 1 - row : row;
+            if (transpose) {
+                std::swap(fromCol, fromRow);
+            }
+            if (cells.get(fromCol, fromRow)) {
+                oriented.set(col, row, true);
+            }
+        }
+    }
+
+    return oriented;
+}
+
+/// Appends \p zeros blank columns the way extended Wechsler format shortens them
+void appendZeros(std::string& code, int zeros) {
+    static constexpr char DIGITS[]{"0123456789abcdefghijklmnopqrstuvwxyz"};
+    constexpr int LONGEST_RUN{39};
+
+    while (zeros >= 4) {
+        const auto run = std::min(zeros, LONGEST_RUN);
+        code += 'y';
+        code += DIGITS[run - 4];
+        zeros -= run;
+    }
+    if (zeros == 3) {
+        code += 'x';
+    } else if (zeros == 2) {
+        code += 'w';
+    } else if (zeros == 1) {
+        code += '0';
+    }
+}
+
+/// Dimensions and Wechsler code of \p cells, which tell every shape apart
+std::string shapeKey(const BitGrid& cells) {
+    return std::to_string(cells.getWidth()) + "x" + std::to_string(cells.getHeight()) + "_"
+            + wechslerCode(cells);
+}
+
+/// True if \p candidate is shorter than \p best, or as long and sorts first
+bool isSmallerCode(const std::string& candidate, const std::string& best) {
+    return best.empty() || candidate.size() < best.size()
+            || (candidate.size() == best.size() && candidate < best);
+}
+}  // namespace
+
+/// \p cells in extended Wechsler format: strips five rows deep, top first, separated by z, each
+/// column of a strip one digit of 0-9a-v with its top cell as the lowest bit
+/// \note Blank columns shorten to w for two, x for three and y with a digit for four to 39;
+/// those at the end of a strip are left out
+std::string wechslerCode(const BitGrid& cells) {
+    static constexpr char DIGITS[]{"0123456789abcdefghijklmnopqrstuv"};
+    constexpr int STRIP_DEPTH{5};
+
+    std::string code;
+    for (auto stripTop = 0; stripTop < cells.getHeight(); stripTop += STRIP_DEPTH) {
+        if (stripTop > 0) {
+            code += 'z';
+        }
+        const auto stripBottom = std::min(stripTop + STRIP_DEPTH, cells.getHeight());
+        auto zeros = 0;
+        for (auto col = 0; col < cells.getWidth(); ++col) {
+            auto digit = 0;
+            for (auto row = stripTop; row < stripBottom; ++row) {
+                digit |= cells.get(col, row) ? 1 << (row - stripTop) : 0;
+            }
+            if (digit == 0) {
+                ++zeros;
+                continue;
+            }
+            appendZeros(code, zeros);
+            zeros = 0;
+            code += DIGITS[digit];
+        }
+    }
+
+    return code;
+}
+
+///
+ObjectClassifier::ObjectClassifier(const Rule& rule)
+    : m_rule(rule) {}
+
+/// Separates \p cells into objects: live cells within INTERACTION_RADIUS of each other form one,
+/// unless they fall into touching groups that would each behave as they do together, in which
+/// case each group is an object of its own, as two blocks side by side are
+/// \note Finds live cells a word at a time and joins whole runs of them, so a board the size of
+/// a screen separates in a few milliseconds once its shapes have been seen
+std::vector<FoundObject> ObjectClassifier::findObjects(const BitGrid& cells) {
+    const auto runs = findRuns(cells);
+    const auto clusterRoots = groupRuns(runs, INTERACTION_RADIUS);
+    const auto partRoots = groupRuns(runs, TOUCHING_RADIUS);
+    std::vector<std::size_t> clusterOf;
+    auto clusters = collectObjects(runs, clusterRoots, clusterOf, [](std::size_t) { return true; });
+
+    // Only clusters of more than one touching part need their parts cut out
+    std::vector<int> partCounts(clusters.size());
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        partCounts[clusterOf[run]] += partRoots[run] == run ? 1 : 0;
+    }
+    const auto isSplit = [&](std::size_t run) { return partCounts[clusterOf[run]] > 1; };
+    std::vector<std::size_t> partOf;
+    auto parts = collectObjects(runs, partRoots, partOf, isSplit);
+    std::vector<std::vector<FoundObject>> partsOf(clusters.size());
+    for (std::size_t run = 0; run < runs.size(); ++run) {
+        if (partRoots[run] == run && isSplit(run)) {
+            partsOf[clusterOf[run]].push_back(std::move(parts[partOf[run]]));
+        }
+    }
+
+    std::vector<FoundObject> objects;
+    objects.reserve(clusters.size());
+    for (std::size_t cluster = 0; cluster < clusters.size(); ++cluster) {
+        if (partsOf[cluster].size() > 1 && isPseudoObject(clusters[cluster], partsOf[cluster])) {
+            for (auto& part : partsOf[cluster]) {
+                part.identity = identify(part.cells);
+                objects.push_back(std::move(part));
+            }
+            continue;
+        }
+
+        clusters[cluster].identity = identify(clusters[cluster].cells);
+        objects.push_back(std::move(clusters[cluster]));
+    }
+
+    return objects;
+}
+
+/// Separates the current generation of \p grid into objects
+/// \note A bounded grid is read where its cells lie; an unbounded plane's live cells are copied
+/// out first, so its objects are placed relative to their top left corner
+std::vector<FoundObject> ObjectClassifier::findObjects(const ConwayGrid& grid) {
+    if (grid.isUnbounded()) {
+        return findObjects(grid.makeCheckpoint().cells);
+    }
+
+    return findObjects(grid.getCells());
+}
+
+/// What \p cells are on their own, worked out once per shape
+ObjectIdentity ObjectClassifier::identify(const BitGrid& cells) {
+    auto key = shapeKey(cells);
+    {
+        std::shared_lock lock(m_mutex);
+        auto found = m_identities.find(key);
+        if (found != m_identities.end()) {
+            return found->second;
+        }
+    }
+
+    auto identity = runAlone(cells);
+    std::unique_lock lock(m_mutex);
+    return m_identities.try_emplace(std::move(key), std::move(identity)).first->second;
+}
+
+/// \note PRIVATE
+/// True if \p parts, run side by side, stay exactly what \p cluster becomes for as long as it
+/// takes the cluster to come back to itself, or OBJECT_MAX_PERIOD generations if it does not
+/// \note Worked out once per shape of cluster
+bool ObjectClassifier::isPseudoObject(
+        const FoundObject& cluster,
+        const std::vector<FoundObject>& parts) {
+    auto key = shapeKey(cluster.cells);
+    {
+        std::shared_lock lock(m_mutex);
+        auto found = m_pseudoObjects.find(key);
+        if (found != m_pseudoObjects.end()) {
+            return found->second;
+        }
+    }
+
+    const auto pseudoObject = runApart(cluster, parts);
+    std::unique_lock lock(m_mutex);
+    return m_pseudoObjects.try_emplace(std::move(key), pseudoObject).first->second;
+}
+
+/// \note PRIVATE
+/// Runs \p cells on their own until they come back to themselves, and names them as apgsearch
+/// does: xs and the population for a still life, xp and the period for an oscillator, xq and
+/// the period for a spaceship, then the shortest, and of those the first, Wechsler code of any
+/// of their phases in any orientation
+/// \note Cells that do not come back within OBJECT_MAX_PERIOD generations, whether they die,
+/// grow or need company they were separated from, are unrecognized
+ObjectIdentity ObjectClassifier::runAlone(const BitGrid& cells) const {
+    SparseGrid grid;
+    grid.setRule(m_rule);
+    grid.pasteCells(cells, 0, 0);
+    const auto population = grid.getPopulation();
+
+    std::int64_t left{0};
+    std::int64_t top{0};
+    std::vector<BitGrid> phases{grid.copyCells(left, top)};
+    for (auto period = 1; period <= OBJECT_MAX_PERIOD && grid.getPopulation() != 0; ++period) {
+        grid.step();
+        std::int64_t phaseLeft{0};
+        std::int64_t phaseTop{0};
+        auto phase = grid.copyCells(phaseLeft, phaseTop);
+        if (!(phase == phases.front())) {
+            phases.push_back(std::move(phase));
+            continue;
+        }
+
+        ObjectIdentity identity;
+        identity.period = period;
+        identity.dx = static_cast<int>(phaseLeft - left);
+        identity.dy = static_cast<int>(phaseTop - top);
+        if (identity.dx != 0 || identity.dy != 0) {
+            identity.apgcode = "xq" + std::to_string(period);
+        } else if (period == 1) {
+            identity.apgcode = "xs" + std::to_string(population);
+        } else {
+            identity.apgcode = "xp" + std::to_string(period);
+        }
+
+        std::string smallest;
+        for (const auto& each : phases) {
+            for (auto orientation = 0; orientation < 8; ++orientation) {
+                auto code = wechslerCode(orient(each, orientation));
+                if (isSmallerCode(code, smallest)) {
+                    smallest = std::move(code);
+                }
+            }
+        }
+        identity.apgcode += "_" + smallest;
+
+        return identity;
+    }
+
+    return {};
+}
+
+/// \note PRIVATE
+/// Runs \p cluster and its \p parts side by side for isPseudoObject()
+bool ObjectClassifier::runApart(const FoundObject& cluster, const std::vector<FoundObject>& parts) {
+    const auto period = identify(cluster.cells).period;
+    const auto generations = period > 0 ? period : OBJECT_MAX_PERIOD;
+
+    SparseGrid together;
+    together.setRule(m_rule);
+    together.pasteCells(cluster.cells, 0, 0);
+    std::vector<SparseGrid> apart(parts.size());
+    for (std::size_t part = 0; part < parts.size(); ++part) {
+        apart[part].setRule(m_rule);
+        apart[part].pasteCells(
+                parts[part].cells, parts[part].left - cluster.left, parts[part].top - cluster.top);
+    }
+
+    for (auto generation = 0; generation < generations; ++generation) {
+        together.step();
+        std::uint64_t population{0};
+        for (auto& part : apart) {
+            part.step();
+            population += part.getPopulation();
+        }
+        if (population != together.getPopulation()) {
+            return false;
+        }
+
+        for (const auto& part : apart) {
+            std::int64_t left{0};
+            std::int64_t top{0};
+            const auto cells = part.copyCells(left, top);
+            for (auto row = 0; row < cells.getHeight(); ++row) {
+                for (auto col = 0; col < cells.getWidth(); ++col) {
+                    if (cells.get(col, row) && !together.isAlive(left + col, top + row)) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+}  // namespace gol
@@ -0,0 +1,86 @@
+/// \file ObjectAnalysis.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+#include "Rule.h"
+
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gol {
+class ConwayGrid;
+
+/// Longest period an object is run on its own for
+constexpr int OBJECT_MAX_PERIOD{60};
+/// Name of cells that do not come back to themselves within OBJECT_MAX_PERIOD generations
+constexpr char UNRECOGNIZED_OBJECT[]{"unrecognized"};
+
+/// How an object behaves on its own
+struct ObjectIdentity {
+    std::string apgcode{UNRECOGNIZED_OBJECT};
+    /// Zero for an object that never comes back to itself
+    int period{0};
+    /// How far the object has moved each period; zero but for spaceships
+    int dx{0};
+    int dy{0};
+};
+
+/// One object of a grid, cropped to its bounds, with its top left corner at (left, top)
+struct FoundObject {
+    BitGrid cells;
+    int left{0};
+    int top{0};
+    ObjectIdentity identity;
+};
+
+std::string wechslerCode(const BitGrid& cells);
+
+/// Separates grids into objects and names each the way apgsearch does
+/// \note Every shape is run on its own once and remembered, so a classifier is best kept for
+/// as long as grids under its rule are being analyzed; it may be shared between threads
+class ObjectClassifier {
+public:
+    explicit ObjectClassifier(const Rule& rule = Rule());
+
+    ObjectClassifier(const ObjectClassifier&) = delete;
+    ObjectClassifier& operator=(const ObjectClassifier&) = delete;
+
+    std::vector<FoundObject> findObjects(const BitGrid& cells);
+    std::vector<FoundObject> findObjects(const ConwayGrid& grid);
+    ObjectIdentity identify(const BitGrid& cells);
+
+private:
+    bool isPseudoObject(const FoundObject& cluster, const std::vector<FoundObject>& parts);
+    ObjectIdentity runAlone(const BitGrid& cells) const;
+    bool runApart(const FoundObject& cluster, const std::vector<FoundObject>& parts);
+
+    Rule m_rule;
+    std::shared_mutex m_mutex;
+    /// Keyed by the dimensions and Wechsler code of the shape as it was found
+    std::unordered_map<std::string, ObjectIdentity> m_identities;
+    /// Whether clusters of each shape that fall into touching parts split into them
+    std::unordered_map<std::string, bool> m_pseudoObjects;
+};
+}  // namespace gol
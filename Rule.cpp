@@ -0,0 +1,163 @@
+/// \file Rule.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Rule.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <string>
+
+namespace gol {
+namespace {
+/// B3/S23
+constexpr std::uint16_t CONWAY_BIRTH_COUNTS{1U << 3};
+constexpr std::uint16_t CONWAY_SURVIVAL_COUNTS{(1U << 2) | (1U << 3)};
+
+/// Sets bit n of \p counts for each digit n in \p digits; false for anything but digits 0-8
+bool parseCounts(const std::string& digits, std::uint16_t& counts) {
+    for (auto digit : digits) {
+        if (digit < '0' || digit > '8') {
+            return false;
+        }
+        counts |= static_cast<std::uint16_t>(1U << (digit - '0'));
+    }
+
+    return true;
+}
+
+///
+std::string countDigits(std::uint16_t counts) {
+    std::string digits;
+    for (auto count = 0; count < NEIGHBOR_COUNTS; ++count) {
+        if ((counts & (1U << count)) != 0) {
+            digits += static_cast<char>('0' + count);
+        }
+    }
+
+    return digits;
+}
+}  // namespace
+
+///
+Rule::Rule()
+    : Rule(CONWAY_BIRTH_COUNTS, CONWAY_SURVIVAL_COUNTS) {}
+
+///
+Rule::Rule(std::uint16_t birthCounts, std::uint16_t survivalCounts)
+    : m_birthCounts(birthCounts)
+    , m_survivalCounts(survivalCounts) {
+    for (auto count = 0; count < NEIGHBOR_COUNTS; ++count) {
+        m_table[count] = isBorn(count) ? ~BitWord{0} : 0;
+        m_table[NEIGHBOR_COUNTS + count] = survives(count) ? ~BitWord{0} : 0;
+    }
+}
+
+/// Reads B/S notation ("B36/S23", either half first, either case) or the older S/B notation
+/// ("23/36"); Seeds is "B2/S", with nothing after the S
+/// \note A suffix after ':' names a bounded grid in Golly's notation, and is ignored here. B0
+/// rules are refused: every empty region would be born at once, which neither the tile
+/// skipping nor the unbounded plane can follow.
+std::optional<Rule> Rule::parse(const std::string& ruleString) {
+    std::string rule;
+    for (auto ch : ruleString.substr(0, ruleString.find(':'))) {
+        if (!std::isspace(static_cast<unsigned char>(ch))) {
+            rule += static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+        }
+    }
+
+    auto slash = rule.find('/');
+    auto first = rule.substr(0, slash);
+    auto second = slash == std::string::npos ? std::string{} : rule.substr(slash + 1);
+
+    std::uint16_t birthCounts{0};
+    std::uint16_t survivalCounts{0};
+    bool parsed = false;
+    if (!first.empty() && (first[0] == 'B' || first[0] == 'S')) {
+        if (first[0] == 'S') {
+            std::swap(first, second);
+        }
+        parsed = first.starts_with('B') && (second.empty() || second.starts_with('S'))
+                && parseCounts(first.substr(1), birthCounts)
+                && parseCounts(second.empty() ? second : second.substr(1), survivalCounts);
+    } else if (slash != std::string::npos) {
+        parsed = parseCounts(first, survivalCounts) && parseCounts(second, birthCounts);
+    }
+
+    if (!parsed) {
+        std::cerr << "Unrecognized rule " << ruleString << std::endl;
+        return std::nullopt;
+    }
+
+    if ((birthCounts & 1U) != 0) {
+        std::cerr << "B0 rules are not supported: " << ruleString << std::endl;
+        return std::nullopt;
+    }
+
+    return Rule(birthCounts, survivalCounts);
+}
+
+///
+bool Rule::operator==(const Rule& rhs) const {
+    return m_birthCounts == rhs.m_birthCounts && m_survivalCounts == rhs.m_survivalCounts;
+}
+
+///
+std::uint16_t Rule::getBirthCounts() const {
+    return m_birthCounts;
+}
+
+/// \note Always in B/S notation, with the counts in ascending order
+std::string Rule::getName() const {
+    std::string name{"B"};
+    name += countDigits(m_birthCounts);
+    name += "/S";
+    name += countDigits(m_survivalCounts);
+
+    return name;
+}
+
+///
+std::uint16_t Rule::getSurvivalCounts() const {
+    return m_survivalCounts;
+}
+
+///
+const RuleTable& Rule::getTable() const {
+    return m_table;
+}
+
+///
+bool Rule::isBorn(int numLivingNeighbors) const {
+    return (m_birthCounts & (1U << numLivingNeighbors)) != 0;
+}
+
+/// \note Conway's rule has its own kernel, a few operations shorter than the table lookup
+bool Rule::isConway() const {
+    return m_birthCounts == CONWAY_BIRTH_COUNTS && m_survivalCounts == CONWAY_SURVIVAL_COUNTS;
+}
+
+///
+bool Rule::survives(int numLivingNeighbors) const {
+    return (m_survivalCounts & (1U << numLivingNeighbors)) != 0;
+}
+}  // namespace gol
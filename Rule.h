@@ -0,0 +1,66 @@
+/// \file Rule.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace gol {
+/// Neighbor counts a cell can have, 0 through 8
+constexpr int NEIGHBOR_COUNTS{9};
+
+/// Birth masks for 0-8 neighbors, then survival masks for 0-8 neighbors; each mask is all ones
+/// or all zeros, so a kernel selects cells by ANDing rather than branching
+using RuleTable = std::array<BitWord, 2 * NEIGHBOR_COUNTS>;
+
+/// Outer-totalistic rule: whether a cell is born, or survives, depends only on its own state
+/// and how many of its eight neighbors are alive
+/// \see https://conwaylife.com/wiki/Rulestring
+/// \note Default constructed, the rule is Conway's B3/S23
+class Rule {
+public:
+    Rule();
+    Rule(std::uint16_t birthCounts, std::uint16_t survivalCounts);
+
+    static std::optional<Rule> parse(const std::string& ruleString);
+
+    bool operator==(const Rule& rhs) const;
+
+    std::uint16_t getBirthCounts() const;
+    std::string getName() const;
+    std::uint16_t getSurvivalCounts() const;
+    const RuleTable& getTable() const;
+    bool isBorn(int numLivingNeighbors) const;
+    bool isConway() const;
+    bool survives(int numLivingNeighbors) const;
+
+private:
+    /// Bit n set when n neighbors give birth, or let a live cell survive
+    std::uint16_t m_birthCounts{0};
+    std::uint16_t m_survivalCounts{0};
+    RuleTable m_table{};
+};
+}  // namespace gol
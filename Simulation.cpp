@@ -0,0 +1,198 @@
+/// \file Simulation.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Simulation.h"
+
+#include "ConwayGrid.h"
+#include "TickScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace gol {
+
+/// \note The initial generation is published at once, so the first acquireFrame() has it
+Simulation::Simulation(ConwayGrid grid)
+    : m_grid(std::move(grid)) {
+    m_telemetry.record({m_grid.getGeneration(), 0.0f, 0.0f, m_grid.getPopulation(), 0, 0});
+    m_grid.trackStateHash();
+    m_cycles.record(m_grid.getGeneration(), m_grid.getStateHash(), m_grid.getPopulation());
+    fillFrame(m_frames.back());
+    m_frames.publish();
+}
+
+///
+Simulation::~Simulation() {
+    stop();
+}
+
+/// \note Display thread only; returns the newest frame if one arrived since the last call
+const Frame* Simulation::acquireFrame() {
+    return m_frames.acquire() ? &m_frames.front() : nullptr;
+}
+
+/// \note Only safe to inspect while the simulation is stopped
+const ConwayGrid& Simulation::getGrid() const {
+    return m_grid;
+}
+
+/// \note One sample per generation stepped; only safe to inspect while the simulation is
+/// stopped
+const Telemetry& Simulation::getTelemetry() const {
+    return m_telemetry;
+}
+
+///
+bool Simulation::isRunning() const {
+    return m_running;
+}
+
+/// \note Any thread; the snapshot is written by the simulation thread once the generation
+/// it is stepping is done, so it never sees a grid half stepped
+void Simulation::requestSnapshot() {
+    m_snapshotRequested = true;
+}
+
+/// \note Call before start(). Every \p checkpointEvery generations, and once more when the
+/// simulation stops, the grid is checkpointed to \p filename on a thread of its own; zero
+/// checkpoints nothing
+void Simulation::setCheckpoints(const std::string& filename, std::uint64_t checkpointEvery) {
+    m_checkpointFile = filename;
+    m_checkpointEvery = checkpointEvery;
+    if (m_checkpointEvery > 0 && !m_checkpointer) {
+        m_checkpointer = std::make_unique<Checkpointer>();
+    }
+}
+
+/// \note Call before start(). Snapshots go to <prefix>_<generation>.rle; with \p dumpEvery,
+/// one is also written every \p dumpEvery generations
+void Simulation::setSnapshots(const std::string& prefix, std::uint64_t dumpEvery) {
+    m_snapshotPrefix = prefix;
+    m_dumpEvery = dumpEvery;
+}
+
+/// \note A tick of zero or less steps as fast as the grid allows; each tick advances
+/// \p generationsPerTick generations, at least one
+void Simulation::start(float tickSecs, int generationsPerTick) {
+    if (m_running.exchange(true)) {
+        return;
+    }
+
+    m_thread = std::thread(&Simulation::run, this, tickSecs, std::max(generationsPerTick, 1));
+}
+
+///
+void Simulation::stop() {
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_running.exchange(false)) {
+            return;
+        }
+    }
+    m_wake.notify_all();
+    m_thread.join();
+}
+
+/// \note PRIVATE
+void Simulation::fillFrame(Frame& frame) const {
+    frame.states.resize(static_cast<std::size_t>(m_grid.getGridWidth()) * m_grid.getGridHeight());
+    m_grid.copyPendingStates(frame.states.data());
+    frame.generation = m_grid.getGeneration();
+    frame.activeTiles = m_grid.getActiveTileCount();
+    frame.tileCount = m_grid.getTileCount();
+    frame.sample = m_telemetry.getLatest();
+}
+
+/// \note PRIVATE
+/// A frame is only built once the display has taken the previous one, so generations the
+/// display would never see cost nothing beyond stepping
+void Simulation::run(float tickSecs, int generationsPerTick) {
+    TickScheduler scheduler(tickSecs);
+
+    while (m_running) {
+        for (auto i = 0; i < generationsPerTick && m_running; ++i) {
+            stepGeneration();
+            if (m_dumpEvery > 0 && m_grid.getGeneration() % m_dumpEvery == 0) {
+                m_grid.writeSnapshot(m_snapshotPrefix);
+            }
+            if (m_checkpointEvery > 0 && m_grid.getGeneration() % m_checkpointEvery == 0) {
+                m_checkpointer->submit(m_checkpointFile, m_grid.makeCheckpoint());
+            }
+        }
+
+        if (m_snapshotRequested.exchange(false)) {
+            m_grid.writeSnapshot(m_snapshotPrefix);
+        }
+
+        if (!m_frames.isFresh()) {
+            fillFrame(m_frames.back());
+            m_frames.publish();
+        }
+
+        if (!scheduler.isMaxSpeed()) {
+            // Sleeps until the deadline, but wakes at once when stopped
+            std::unique_lock lock(m_mutex);
+            m_wake.wait_until(lock, scheduler.advance(), [this] { return !m_running; });
+        }
+    }
+
+    // Whatever was stepped last is what the display should end on, and what a resumed run
+    // should start from
+    fillFrame(m_frames.back());
+    m_frames.publish();
+    if (m_checkpointEvery > 0) {
+        m_checkpointer->submit(m_checkpointFile, m_grid.makeCheckpoint());
+    }
+}
+
+/// \note PRIVATE
+void Simulation::stepGeneration() {
+    using Clock = std::chrono::steady_clock;
+    const auto stepStart = Clock::now();
+    m_grid.step();
+    const std::chrono::duration<float, std::micro> computed = Clock::now() - stepStart;
+    m_telemetry.record(
+            {m_grid.getGeneration(),
+             computed.count(),
+             0.0f,
+             m_grid.getPopulation(),
+             m_grid.getBirths(),
+             m_grid.getDeaths()});
+    // Logged once; the run carries on, since there may still be something to watch
+    if (!m_cycle.has_value()) {
+        m_cycle = m_cycles.record(
+                m_grid.getGeneration(),
+                m_grid.getStateHash(),
+                m_grid.getPopulation());
+        if (m_cycle.has_value()) {
+            std::clog << "Generation " << m_grid.getGeneration() << " repeats generation "
+                      << m_cycle->onset << ": period " << m_cycle->period << std::endl;
+        }
+    }
+}
+}  // namespace gol
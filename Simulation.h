@@ -0,0 +1,95 @@
+/// \file Simulation.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "Checkpoint.h"
+#include "ConwayGrid.h"
+#include "CycleDetector.h"
+#include "Telemetry.h"
+#include "TripleBuffer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gol {
+
+/// One generation as the display sees it
+struct Frame {
+    /// CellPending of each cell, row by row, a byte apiece
+    std::vector<std::uint8_t> states;
+    std::uint64_t generation{0};
+    std::size_t activeTiles{0};
+    std::size_t tileCount{0};
+    TelemetrySample sample;
+};
+
+/// Steps a ConwayGrid on its own thread, handing generations to the display through a
+/// lock-free triple buffer, so neither a slow generation nor a slow display holds up the other
+class Simulation {
+public:
+    explicit Simulation(ConwayGrid grid);
+    ~Simulation();
+
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    const Frame* acquireFrame();
+    const ConwayGrid& getGrid() const;
+    const Telemetry& getTelemetry() const;
+    bool isRunning() const;
+    void requestSnapshot();
+    void setCheckpoints(const std::string& filename, std::uint64_t checkpointEvery);
+    void setSnapshots(const std::string& prefix, std::uint64_t dumpEvery = 0);
+    void start(float tickSecs, int generationsPerTick = 1);
+    void stop();
+
+private:
+    void fillFrame(Frame& frame) const;
+    void run(float tickSecs, int generationsPerTick);
+    void stepGeneration();
+
+    ConwayGrid m_grid;
+    std::string m_snapshotPrefix{"snapshot"};
+    std::uint64_t m_dumpEvery{0};
+    std::atomic<bool> m_snapshotRequested{false};
+    std::string m_checkpointFile;
+    std::uint64_t m_checkpointEvery{0};
+    std::unique_ptr<Checkpointer> m_checkpointer;
+    Telemetry m_telemetry;
+    CycleDetector m_cycles;
+    std::optional<Cycle> m_cycle;
+    TripleBuffer<Frame> m_frames;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::atomic<bool> m_running{false};
+};
+}  // namespace gol
@@ -0,0 +1,295 @@
+/// \file Soup.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Soup.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace gol {
+namespace {
+/// Bits a soup's density is kept to, a 256th being as fine as a soup needs; a density other than
+/// one half takes up to this many draws of the generator for each 64 cells
+constexpr int DENSITY_BITS{8};
+
+/// SplitMix64, so that neighboring seeds start unrelated generators
+std::uint64_t mixSeed(std::uint64_t seed) {
+    seed += 0x9E3779B97F4A7C15ULL;
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+    return seed ^ (seed >> 31);
+}
+
+/// Draws 64 cells at a time, each alive with the soup's density
+/// \note Each draw is an even coin for all 64 cells; working up the density's binary fraction
+/// from its lowest set bit, a set bit ORs the next draw into the cells so far and a clear bit
+/// ANDs it in, which leaves each cell alive with exactly that fraction. One half takes a single
+/// draw.
+class CellDrawer {
+public:
+    explicit CellDrawer(const SoupConfig& config)
+        : m_generator(mixSeed(config.seed))
+        , m_fraction(static_cast<std::uint32_t>(
+                  std::lround(std::clamp(config.density, 0.0, 1.0) * (1 << DENSITY_BITS)))) {}
+
+    ///
+    BitWord draw() {
+        if (m_fraction == 0) {
+            return 0;
+        }
+        if (m_fraction >= 1U << DENSITY_BITS) {
+            return ~BitWord{0};
+        }
+
+        BitWord cells = m_generator();
+        for (auto bit = std::countr_zero(m_fraction) + 1; bit < DENSITY_BITS; ++bit) {
+            cells = ((m_fraction >> bit) & 1) != 0 ? cells | m_generator() : cells & m_generator();
+        }
+
+        return cells;
+    }
+
+private:
+    std::mt19937_64 m_generator;
+    std::uint32_t m_fraction{0};
+};
+
+/// Draws cells [\p begin, \p end) of \p row, a word at a time
+void drawCells(BitGrid& cells, int row, int begin, int end, CellDrawer& drawer) {
+    auto* words = cells.rowWords(row);
+    for (auto col = begin; col < end; col = (col / BITS_PER_WORD + 1) * BITS_PER_WORD) {
+        const auto bit = col % BITS_PER_WORD;
+        const auto span = std::min(BITS_PER_WORD - bit, end - col);
+        const auto mask = span == BITS_PER_WORD ? ~BitWord{0} : ((BitWord{1} << span) - 1);
+        words[col / BITS_PER_WORD] |= (drawer.draw() & mask) << bit;
+    }
+}
+
+/// \p word with its bits in the opposite order
+BitWord reverseBits(BitWord word) {
+    word = ((word >> 1) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1);
+    word = ((word >> 2) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2);
+    word = ((word >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    word = ((word >> 8) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8);
+    word = ((word >> 16) & 0x0000FFFF0000FFFFULL) | ((word & 0x0000FFFF0000FFFFULL) << 16);
+    return (word >> 32) | (word << 32);
+}
+
+/// Transposes a 64x64 block in place, so that bit c of word r ends up as bit r of word c
+void transposeBlock(std::array<BitWord, BITS_PER_WORD>& block) {
+    auto mask = BitWord{0x00000000FFFFFFFFULL};
+    for (auto span = BITS_PER_WORD / 2; span != 0; span >>= 1, mask ^= mask << span) {
+        for (auto word = 0; word < BITS_PER_WORD; word = ((word | span) + 1) & ~span) {
+            const auto swapped = ((block[word] >> span) ^ block[word | span]) & mask;
+            block[word] ^= swapped << span;
+            block[word | span] ^= swapped;
+        }
+    }
+}
+
+/// \p cells mirrored left to right, reversing each row a word at a time
+BitGrid flipLeftRight(const BitGrid& cells) {
+    const auto wordsPerRow = cells.getWordsPerRow();
+    // Reversing whole words mirrors the row about the end of its last word; shifting back by
+    // the unused bits lines it up with the end of the row
+    const auto shift = wordsPerRow * BITS_PER_WORD - cells.getWidth();
+    const auto wordShift = shift / BITS_PER_WORD;
+    const auto bitShift = shift % BITS_PER_WORD;
+
+    BitGrid flipped(cells.getWidth(), cells.getHeight());
+    std::vector<BitWord> reversed(wordsPerRow + 1);
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        const auto* words = cells.rowWords(row);
+        for (auto word = 0; word < wordsPerRow; ++word) {
+            const auto source = wordsPerRow - 1 - word;
+            reversed[word] = reverseBits(source == wordsPerRow - 1
+                            ? words[source] & cells.getLastWordMask()
+                            : words[source]);
+        }
+
+        auto* flippedWords = flipped.rowWords(row);
+        for (auto word = 0; word + wordShift < wordsPerRow; ++word) {
+            flippedWords[word] = reversed[word + wordShift] >> bitShift;
+            if (bitShift != 0) {
+                flippedWords[word] |= reversed[word + wordShift + 1] << (BITS_PER_WORD - bitShift);
+            }
+        }
+    }
+
+    return flipped;
+}
+
+/// \p cells mirrored top to bottom
+BitGrid flipTopBottom(const BitGrid& cells) {
+    BitGrid flipped(cells.getWidth(), cells.getHeight());
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        const auto* words = cells.rowWords(row);
+        std::copy(words,
+                words + cells.getWordsPerRow(),
+                flipped.rowWords(cells.getHeight() - 1 - row));
+    }
+
+    return flipped;
+}
+
+/// \p cells with rows and columns swapped, 64x64 cells at a time
+BitGrid transpose(const BitGrid& cells) {
+    const auto width = cells.getWidth();
+    const auto height = cells.getHeight();
+    const auto lastWord = cells.getWordsPerRow() - 1;
+    BitGrid transposed(height, width);
+    std::array<BitWord, BITS_PER_WORD> block{};
+
+    for (auto blockTop = 0; blockTop < height; blockTop += BITS_PER_WORD) {
+        for (auto blockLeft = 0; blockLeft < width; blockLeft += BITS_PER_WORD) {
+            const auto word = blockLeft / BITS_PER_WORD;
+            for (auto row = 0; row < BITS_PER_WORD; ++row) {
+                block[row] = 0;
+                if (blockTop + row < height) {
+                    block[row] = cells.rowWords(blockTop + row)[word]
+                            & (word == lastWord ? cells.getLastWordMask() : ~BitWord{0});
+                }
+            }
+
+            transposeBlock(block);
+            for (auto col = 0; col < BITS_PER_WORD && blockLeft + col < width; ++col) {
+                transposed.rowWords(blockLeft + col)[blockTop / BITS_PER_WORD] = block[col];
+            }
+        }
+    }
+
+    return transposed;
+}
+
+/// Adds the live cells of \p from, the same size, to \p into
+void merge(BitGrid& into, const BitGrid& from) {
+    for (auto row = 0; row < into.getHeight(); ++row) {
+        auto* intoWords = into.rowWords(row);
+        const auto* fromWords = from.rowWords(row);
+        for (auto word = 0; word < into.getWordsPerRow(); ++word) {
+            intoWords[word] |= fromWords[word];
+        }
+    }
+}
+}  // namespace
+
+///
+std::optional<SoupSymmetry> parseSoupSymmetry(const std::string& name) {
+    std::string upper(name);
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+    for (auto symmetry : {SoupSymmetry::C1, SoupSymmetry::C2, SoupSymmetry::C4, SoupSymmetry::D8}) {
+        if (upper == soupSymmetryName(symmetry)) {
+            return symmetry;
+        }
+    }
+
+    return std::nullopt;
+}
+
+///
+std::string soupSymmetryName(SoupSymmetry symmetry) {
+    switch (symmetry) {
+    case SoupSymmetry::C2:
+        return "C2";
+    case SoupSymmetry::C4:
+        return "C4";
+    case SoupSymmetry::D8:
+        return "D8";
+    default:
+        return "C1";
+    }
+}
+
+/// A \p width by \p height soup drawn as \p config says, straight into the bit grid, 64 cells
+/// to a draw of the generator
+/// \note A symmetric soup draws only the cells no other cell is the image of, then adds its
+/// own images to itself: turned half way for C2, a quarter and a half for C4, and transposed
+/// and flipped both ways for D8. Cells on a mirror line or at the center are drawn once, so
+/// every cell keeps the soup's density.
+BitGrid makeSoup(int width, int height, const SoupConfig& config) {
+    CellDrawer drawer(config);
+    if (config.symmetry == SoupSymmetry::C1 || config.symmetry == SoupSymmetry::C2) {
+        BitGrid soup(width, height);
+        const auto drawnRows = config.symmetry == SoupSymmetry::C1 ? height : height / 2;
+        for (auto row = 0; row < drawnRows; ++row) {
+            drawCells(soup, row, 0, width, drawer);
+        }
+        if (config.symmetry == SoupSymmetry::C2) {
+            // The middle row of an odd height turns onto itself
+            if (height % 2 != 0) {
+                drawCells(soup, height / 2, 0, (width + 1) / 2, drawer);
+            }
+            merge(soup, flipTopBottom(flipLeftRight(soup)));
+        }
+
+        return soup;
+    }
+
+    const auto side = std::min(width, height);
+    const auto half = (side + 1) / 2;
+    BitGrid square(side, side);
+    if (config.symmetry == SoupSymmetry::C4) {
+        // The top left quadrant, less the middle row of an odd side, which the quarter turn
+        // brings round from the middle column; the center turns onto itself
+        for (auto row = 0; row < side / 2; ++row) {
+            drawCells(square, row, 0, half, drawer);
+        }
+        if (side % 2 != 0) {
+            drawCells(square, half - 1, half - 1, half, drawer);
+        }
+        merge(square, flipLeftRight(transpose(square)));
+        merge(square, flipTopBottom(flipLeftRight(square)));
+    } else {
+        // The top left quadrant on and above its diagonal
+        for (auto row = 0; row < half; ++row) {
+            drawCells(square, row, row, half, drawer);
+        }
+        merge(square, transpose(square));
+        merge(square, flipLeftRight(square));
+        merge(square, flipTopBottom(square));
+    }
+
+    if (side == width && side == height) {
+        return square;
+    }
+
+    BitGrid soup(width, height);
+    soup.blit(square, (width - side) / 2, (height - side) / 2);
+    return soup;
+}
+
+/// A seed from the system's entropy source, for a soup that need only be drawn again if its
+/// seed is kept
+std::uint64_t randomSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) | device();
+}
+}  // namespace gol
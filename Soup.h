@@ -0,0 +1,52 @@
+/// \file Soup.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace gol {
+/// Fraction of a soup's cells alive unless asked otherwise
+constexpr double SOUP_DENSITY{0.5};
+
+/// Symmetries a soup can be drawn with, named as apgsearch names them: none, a half turn, a
+/// quarter turn, and every rotation and reflection of the square
+/// \note C4 and D8 soups are square; on a grid that is not, they fill the largest centered
+/// square and leave the rest dead
+enum class SoupSymmetry { C1, C2, C4, D8 };
+
+std::optional<SoupSymmetry> parseSoupSymmetry(const std::string& name);
+std::string soupSymmetryName(SoupSymmetry symmetry);
+
+/// How to draw a soup; the same config draws the same soup on any machine
+struct SoupConfig {
+    std::uint64_t seed{0};
+    double density{SOUP_DENSITY};
+    SoupSymmetry symmetry{SoupSymmetry::C1};
+};
+
+BitGrid makeSoup(int width, int height, const SoupConfig& config);
+std::uint64_t randomSeed();
+}  // namespace gol
@@ -0,0 +1,395 @@
+/// \file SparseGrid.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "SparseGrid.h"
+
+#include "BitGrid.h"
+#include "ConwayDefs.h"
+#include "CycleDetector.h"
+#include "LifeKernelImpl.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace gol {
+namespace {
+struct SparseIsa {};
+
+/// \note Arithmetic shifts floor, so negative cells land in negative chunks
+ChunkKey chunkOf(std::int64_t x, std::int64_t y) {
+    return {x >> 6, y >> 6};
+}
+
+///
+int bitOf(std::int64_t coordinate) {
+    return static_cast<int>(coordinate & (CHUNK_SIZE - 1));
+}
+}  // namespace
+
+/// \note splitmix64 finalizer over both coordinates
+std::size_t ChunkKeyHash::operator()(const ChunkKey& key) const {
+    auto hash = static_cast<std::uint64_t>(key.x) * 0x9E3779B97F4A7C15ULL
+            ^ static_cast<std::uint64_t>(key.y);
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(hash ^ (hash >> 31));
+}
+
+/// Copies the live cells into a grid just large enough to hold them, a chunk row at a time
+/// \note An empty plane copies as a single dead cell
+BitGrid SparseGrid::copyCells() const {
+    std::int64_t left{0};
+    std::int64_t top{0};
+    return copyCells(left, top);
+}
+
+/// As copyCells(), also giving where on the plane the grid's top left corner lies
+BitGrid SparseGrid::copyCells(std::int64_t& left, std::int64_t& top) const {
+    left = std::numeric_limits<std::int64_t>::max();
+    auto right = std::numeric_limits<std::int64_t>::min();
+    top = left;
+    auto bottom = right;
+    for (const auto& [key, chunk] : m_chunks) {
+        for (auto row = 0; row < CHUNK_SIZE; ++row) {
+            const auto word = chunk.generations[m_front][row];
+            if (word != 0) {
+                const auto chunkLeft = key.x * CHUNK_SIZE;
+                left = std::min<std::int64_t>(left, chunkLeft + std::countr_zero(word));
+                right = std::max<std::int64_t>(
+                        right, chunkLeft + BITS_PER_WORD - 1 - std::countl_zero(word));
+                top = std::min(top, key.y * CHUNK_SIZE + row);
+                bottom = std::max(bottom, key.y * CHUNK_SIZE + row);
+            }
+        }
+    }
+
+    if (left > right) {
+        left = 0;
+        top = 0;
+        return BitGrid(1, 1);
+    }
+
+    BitGrid cells(static_cast<int>(right - left + 1), static_cast<int>(bottom - top + 1));
+    for (const auto& [key, chunk] : m_chunks) {
+        for (auto row = 0; row < CHUNK_SIZE; ++row) {
+            auto word = chunk.generations[m_front][row];
+            if (word == 0) {
+                continue;
+            }
+
+            // Cells left of the leftmost live cell are dead, so may be shifted out
+            auto col = key.x * CHUNK_SIZE - left;
+            if (col < 0) {
+                word >>= -col;
+                col = 0;
+            }
+
+            // Bits past the rightmost live cell are dead, so may spill into the guard word
+            auto* words = cells.rowWords(static_cast<int>(key.y * CHUNK_SIZE + row - top));
+            const auto bit = col % BITS_PER_WORD;
+            words[col / BITS_PER_WORD] |= word << bit;
+            if (bit != 0) {
+                words[col / BITS_PER_WORD + 1] |= word >> (BITS_PER_WORD - bit);
+            }
+        }
+    }
+
+    return cells;
+}
+
+/// \note Cells born by the last step
+std::uint64_t SparseGrid::getBirths() const {
+    return m_births;
+}
+
+///
+std::size_t SparseGrid::getChunkCount() const {
+    return m_chunks.size();
+}
+
+/// \note Cells that died in the last step
+std::uint64_t SparseGrid::getDeaths() const {
+    return m_deaths;
+}
+
+///
+std::uint64_t SparseGrid::getGeneration() const {
+    return m_generation;
+}
+
+/// \note Approximate: chunk payloads plus a pointer's worth of hash table bucket each
+std::size_t SparseGrid::getMemoryUsage() const {
+    return m_chunks.size() * sizeof(Chunk) + m_chunks.bucket_count() * sizeof(void*);
+}
+
+/// \note Derived the same way as ConwayGrid::getPendingState()
+CellPending SparseGrid::getPendingState(std::int64_t x, std::int64_t y) const {
+    const auto* chunk = findChunk(x, y);
+    if (chunk == nullptr) {
+        return CELL_ASLEEP;
+    }
+
+    const auto bit = BitWord{1} << bitOf(x);
+    const auto row = bitOf(y);
+    const auto alive = (chunk->generations[m_front ^ 1][row] & bit) != 0;
+    if ((chunk->generations[m_front][row] & bit) != 0) {
+        return alive ? CELL_LIVING : CELL_REBORN;
+    }
+
+    if ((chunk->choked[row] & bit) != 0) {
+        return CELL_CHOKED;
+    }
+
+    return alive ? CELL_LONELY : CELL_ASLEEP;
+}
+
+/// \note Kept up to date by setCell() and each step's births and deaths
+std::uint64_t SparseGrid::getPopulation() const {
+    return m_population;
+}
+
+///
+bool SparseGrid::isAlive(std::int64_t x, std::int64_t y) const {
+    const auto* chunk = findChunk(x, y);
+    return chunk != nullptr && ((chunk->generations[m_front][bitOf(y)] >> bitOf(x)) & 1U) != 0;
+}
+
+///
+const Rule& SparseGrid::getRule() const {
+    return m_rule;
+}
+
+/// \note Word columns are chunk columns, and rows count from the top of chunk row 0
+std::uint64_t SparseGrid::getStateHash() const {
+    return m_stateHash;
+}
+
+/// \note True once a step leaves every cell as it was
+bool SparseGrid::isStill() const {
+    return !m_changed;
+}
+
+/// Sets the live cells of \p cells with its top left corner at (left, top) of the plane
+/// \note As setCell() does, so only live cells are visited, a word at a time
+void SparseGrid::pasteCells(const BitGrid& cells, std::int64_t left, std::int64_t top) {
+    for (auto row = 0; row < cells.getHeight(); ++row) {
+        const auto* words = cells.rowWords(row);
+        for (auto i = 0; i < cells.getWordsPerRow(); ++i) {
+            auto word = (i == cells.getWordsPerRow() - 1) ? words[i] & cells.getLastWordMask()
+                                                          : words[i];
+            for (; word != 0; word &= word - 1) {
+                setCell(left + i * BITS_PER_WORD + std::countr_zero(word), top + row, true);
+            }
+        }
+    }
+}
+
+/// \note Sets the cell in both generations, as though it had always been that way
+void SparseGrid::setCell(std::int64_t x, std::int64_t y, bool alive) {
+    if (!alive && findChunk(x, y) == nullptr) {
+        return;
+    }
+    if (alive != isAlive(x, y)) {
+        m_population = alive ? m_population + 1 : m_population - 1;
+    }
+
+    const auto key = chunkOf(x, y);
+    auto& chunk = m_chunks[key];
+    const auto bit = BitWord{1} << bitOf(x);
+    const auto hashRow = key.y * CHUNK_SIZE + bitOf(y);
+    m_stateHash ^= hashWord(key.x, hashRow, chunk.generations[m_front][bitOf(y)]);
+    for (auto& generation : chunk.generations) {
+        auto& word = generation[bitOf(y)];
+        word = alive ? (word | bit) : (word & ~bit);
+    }
+    m_stateHash ^= hashWord(key.x, hashRow, chunk.generations[m_front][bitOf(y)]);
+    chunk.changedAt = m_generation;
+    m_changed = true;
+}
+
+/// \note Births stay next to live cells under any rule without B0, so the chunks added around
+/// the live ones are still the only places anything can appear
+/// \note Every chunk counts as changed, since a chunk that was still under the old rule is
+/// skipped on the strength of that, and may not be still under the new one
+void SparseGrid::setRule(const Rule& rule) {
+    m_rule = rule;
+    for (auto& [key, chunk] : m_chunks) {
+        chunk.changedAt = m_generation;
+    }
+    m_changed = true;
+}
+
+///
+void SparseGrid::step() {
+    addBorderChunks();
+
+    ++m_generation;
+    m_front ^= 1;
+    m_births = 0;
+    m_deaths = 0;
+    for (auto& [key, chunk] : m_chunks) {
+        stepChunk(key, chunk);
+    }
+    m_changed = m_births != 0 || m_deaths != 0;
+    m_population += m_births;
+    m_population -= m_deaths;
+
+    pruneChunks();
+}
+
+/// \note Whether the cell was alive in the previous generation
+bool SparseGrid::wasAlive(std::int64_t x, std::int64_t y) const {
+    const auto* chunk = findChunk(x, y);
+    return chunk != nullptr
+            && ((chunk->generations[m_front ^ 1][bitOf(y)] >> bitOf(x)) & 1U) != 0;
+}
+
+/// \note PRIVATE
+/// Adds the empty neighbors into which live cells on a chunk's edges could give birth
+void SparseGrid::addBorderChunks() {
+    std::vector<ChunkKey> border;
+    for (const auto& [key, chunk] : m_chunks) {
+        const auto& rows = chunk.generations[m_front];
+        BitWord anyRow = 0;
+        for (auto word : rows) {
+            anyRow |= word;
+        }
+        if (anyRow == 0) {
+            continue;
+        }
+
+        const bool edges[3][3]{
+                {(rows.front() & 1U) != 0, rows.front() != 0, (rows.front() >> 63) != 0},
+                {(anyRow & 1U) != 0, false, (anyRow >> 63) != 0},
+                {(rows.back() & 1U) != 0, rows.back() != 0, (rows.back() >> 63) != 0}};
+        for (auto dy = -1; dy <= 1; ++dy) {
+            for (auto dx = -1; dx <= 1; ++dx) {
+                ChunkKey neighbor{key.x + dx, key.y + dy};
+                if (edges[dy + 1][dx + 1] && !m_chunks.contains(neighbor)) {
+                    border.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    for (const auto& key : border) {
+        m_chunks.try_emplace(key);
+    }
+}
+
+/// \note PRIVATE
+const SparseGrid::Chunk* SparseGrid::findChunk(std::int64_t x, std::int64_t y) const {
+    auto found = m_chunks.find(chunkOf(x, y));
+    return found == m_chunks.end() ? nullptr : &found->second;
+}
+
+/// \note PRIVATE
+/// A chunk with nothing alive, dying or choked in it has nothing left to show
+void SparseGrid::pruneChunks() {
+    std::erase_if(m_chunks, [](const auto& entry) {
+        const auto& chunk = entry.second;
+        auto isEmpty = [](const ChunkRows& rows) {
+            return std::all_of(rows.begin(), rows.end(), [](BitWord word) { return word == 0; });
+        };
+        return isEmpty(chunk.generations[0]) && isEmpty(chunk.generations[1])
+                && isEmpty(chunk.choked);
+    });
+}
+
+/// \note PRIVATE
+/// Each row is stepped as the middle word of three, with the words of the west and east
+/// chunks on either side, so the lane kernel sees the same halo a BitGrid row provides
+/// \note A chunk none of whose neighbors, itself included, changed in the last step is skipped:
+/// it cannot change either, and both its generations already hold what stepping would write
+void SparseGrid::stepChunk(const ChunkKey& key, Chunk& chunk) {
+    static const ChunkRows EMPTY_ROWS{};
+    const ChunkRows* around[3][3];
+    auto isQuiet = true;
+    for (auto dy = -1; dy <= 1; ++dy) {
+        for (auto dx = -1; dx <= 1; ++dx) {
+            auto found = m_chunks.find({key.x + dx, key.y + dy});
+            if (found == m_chunks.end()) {
+                around[dy + 1][dx + 1] = &EMPTY_ROWS;
+            } else {
+                around[dy + 1][dx + 1] = &found->second.generations[m_front ^ 1];
+                isQuiet = isQuiet && found->second.changedAt + 1 < m_generation;
+            }
+        }
+    }
+    if (isQuiet) {
+        return;
+    }
+
+    auto threeWords = [&around](int row, BitWord* words) {
+        auto band = row < 0 ? 0 : (row >= CHUNK_SIZE ? 2 : 1);
+        auto chunkRow = (row + CHUNK_SIZE) % CHUNK_SIZE;
+        for (auto col = 0; col < 3; ++col) {
+            words[col] = (*around[band][col])[chunkRow];
+        }
+    };
+
+    BitWord above[3];
+    BitWord middle[3];
+    BitWord below[3];
+    threeWords(-1, above);
+    threeWords(0, middle);
+    auto& next = chunk.generations[m_front];
+    const auto isConway = m_rule.isConway();
+    const auto& table = m_rule.getTable();
+    for (auto row = 0; row < CHUNK_SIZE; ++row) {
+        threeWords(row + 1, below);
+        // Most rows of a chunk holding a spaceship or a still life have nothing near them
+        if ((above[0] | above[1] | above[2] | middle[0] | middle[1] | middle[2] | below[0]
+             | below[1] | below[2])
+            == 0) {
+            next[row] = 0;
+            chunk.choked[row] = 0;
+            std::copy_n(middle, 3, above);
+            std::copy_n(below, 3, middle);
+            continue;
+        }
+
+        if (isConway) {
+            lifeLane<ScalarLane<SparseIsa>>(
+                    above + 1, middle + 1, below + 1, &next[row], &chunk.choked[row]);
+        } else {
+            ruleLane<ScalarLane<SparseIsa>>(
+                    above + 1, middle + 1, below + 1, &next[row], &chunk.choked[row], table);
+        }
+        m_births += std::popcount(next[row] & ~middle[1]);
+        m_deaths += std::popcount(middle[1] & ~next[row]);
+        if (next[row] != middle[1]) {
+            chunk.changedAt = m_generation;
+            const auto hashRow = key.y * CHUNK_SIZE + row;
+            m_stateHash ^= hashWord(key.x, hashRow, middle[1])
+                    ^ hashWord(key.x, hashRow, next[row]);
+        }
+
+        std::copy_n(middle, 3, above);
+        std::copy_n(below, 3, middle);
+    }
+}
+}  // namespace gol
@@ -0,0 +1,104 @@
+/// \file SparseGrid.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include "BitGrid.h"
+#include "ConwayDefs.h"
+#include "Rule.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace gol {
+/// Cells per side of a SparseGrid chunk; one row of a chunk is one word
+constexpr int CHUNK_SIZE{BITS_PER_WORD};
+
+/// Chunk (x, y) holds cells [64x, 64x + 64) by [64y, 64y + 64)
+struct ChunkKey {
+    std::int64_t x{0};
+    std::int64_t y{0};
+
+    bool operator==(const ChunkKey& rhs) const = default;
+};
+
+///
+struct ChunkKeyHash {
+    std::size_t operator()(const ChunkKey& key) const;
+};
+
+/// Unbounded plane stored as a hash map of 64x64 chunks, so memory follows the population
+/// rather than the bounding box; chunks appear where births may happen and are dropped once
+/// empty
+/// \note x grows rightward and y downward, and both may go negative
+class SparseGrid {
+public:
+    SparseGrid() = default;
+
+    BitGrid copyCells() const;
+    BitGrid copyCells(std::int64_t& left, std::int64_t& top) const;
+    std::uint64_t getBirths() const;
+    std::size_t getChunkCount() const;
+    std::uint64_t getDeaths() const;
+    std::uint64_t getGeneration() const;
+    std::size_t getMemoryUsage() const;
+    CellPending getPendingState(std::int64_t x, std::int64_t y) const;
+    std::uint64_t getPopulation() const;
+    const Rule& getRule() const;
+    std::uint64_t getStateHash() const;
+    bool isAlive(std::int64_t x, std::int64_t y) const;
+    bool isStill() const;
+    void pasteCells(const BitGrid& cells, std::int64_t left, std::int64_t top);
+    void setCell(std::int64_t x, std::int64_t y, bool alive);
+    void setRule(const Rule& rule);
+    void step();
+    bool wasAlive(std::int64_t x, std::int64_t y) const;
+
+private:
+    using ChunkRows = std::array<BitWord, CHUNK_SIZE>;
+
+    /// Two generations, swapped by the grid's front index, plus the choked cells of the newer
+    struct Chunk {
+        std::array<ChunkRows, 2> generations{};
+        ChunkRows choked{};
+        /// Generation of the last step, or setCell(), that changed the chunk
+        std::uint64_t changedAt{0};
+    };
+
+    void addBorderChunks();
+    const Chunk* findChunk(std::int64_t x, std::int64_t y) const;
+    void pruneChunks();
+    void stepChunk(const ChunkKey& key, Chunk& chunk);
+
+    std::unordered_map<ChunkKey, Chunk, ChunkKeyHash> m_chunks;
+    Rule m_rule;
+    int m_front{0};
+    std::uint64_t m_generation{0};
+    std::uint64_t m_births{0};
+    std::uint64_t m_deaths{0};
+    std::uint64_t m_population{0};
+    /// XOR of hashWord() over the newer generation of every chunk row
+    std::uint64_t m_stateHash{0};
+    bool m_changed{true};
+};
+}  // namespace gol
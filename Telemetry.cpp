@@ -0,0 +1,129 @@
+/// \file Telemetry.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Telemetry.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace gol {
+
+///
+Telemetry::Telemetry(std::size_t capacity)
+    : m_samples(capacity == 0 ? 1 : capacity) {}
+
+/// \note Only meaningful when the ring is not empty
+const TelemetrySample& Telemetry::getLatest() const {
+    return m_samples[(m_next + m_samples.size() - 1) % m_samples.size()];
+}
+
+/// \note Index 0 is the oldest sample still held
+const TelemetrySample& Telemetry::getSample(std::size_t index) const {
+    return m_samples[(m_next + m_samples.size() - m_size + index) % m_samples.size()];
+}
+
+///
+std::size_t Telemetry::getSize() const {
+    return m_size;
+}
+
+///
+bool Telemetry::isEmpty() const {
+    return m_size == 0;
+}
+
+/// \note Copies the render times of \p frames, sampled by the display, onto the generations
+/// they showed; both rings run in generation order, so one pass matches them up
+void Telemetry::mergeRenderTimes(const Telemetry& frames) {
+    std::size_t frame = 0;
+    for (std::size_t i = 0; i < m_size && frame < frames.getSize(); ++i) {
+        auto& sample = m_samples[(m_next + m_samples.size() - m_size + i) % m_samples.size()];
+        while (frame < frames.getSize() && frames.getSample(frame).generation < sample.generation) {
+            ++frame;
+        }
+        if (frame < frames.getSize() && frames.getSample(frame).generation == sample.generation) {
+            sample.renderMicros = frames.getSample(frame).renderMicros;
+        }
+    }
+}
+
+///
+void Telemetry::record(const TelemetrySample& sample) {
+    m_samples[m_next] = sample;
+    m_next = (m_next + 1) % m_samples.size();
+    if (m_size < m_samples.size()) {
+        ++m_size;
+    }
+}
+
+/// \note A .json file gets an array of objects, anything else comma separated values
+bool Telemetry::write(const std::string& filename) const {
+    std::ofstream out(filename);
+    if (!out) {
+        std::cerr << "Unable to write telemetry to " << filename << std::endl;
+        return false;
+    }
+
+    auto written = std::filesystem::path(filename).extension() == ".json" ? writeJSON(out)
+                                                                           : writeCSV(out);
+    if (written) {
+        std::clog << "Wrote " << m_size << " telemetry samples to " << filename << std::endl;
+    }
+
+    return written;
+}
+
+/// \note PRIVATE
+bool Telemetry::writeCSV(std::ostream& out) const {
+    out << "generation,compute_us,render_us,population,births,deaths\n";
+    for (std::size_t i = 0; i < m_size; ++i) {
+        const auto& sample = getSample(i);
+        out << sample.generation << ',' << sample.computeMicros << ',' << sample.renderMicros
+            << ',' << sample.population << ',' << sample.births << ',' << sample.deaths << '\n';
+    }
+
+    return static_cast<bool>(out.flush());
+}
+
+/// \note PRIVATE
+bool Telemetry::writeJSON(std::ostream& out) const {
+    auto samples = nlohmann::json::array();
+    for (std::size_t i = 0; i < m_size; ++i) {
+        const auto& sample = getSample(i);
+        samples.push_back(
+                {{"generation", sample.generation},
+                 {"compute_us", sample.computeMicros},
+                 {"render_us", sample.renderMicros},
+                 {"population", sample.population},
+                 {"births", sample.births},
+                 {"deaths", sample.deaths}});
+    }
+    out << samples.dump(2) << std::endl;
+
+    return static_cast<bool>(out);
+}
+}  // namespace gol
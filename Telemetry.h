@@ -0,0 +1,68 @@
+/// \file Telemetry.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace gol {
+/// Samples kept by a Telemetry ring; at 60 generations per second, a bit over a minute
+constexpr std::size_t TELEMETRY_CAPACITY{4096};
+
+/// One generation as the telemetry sees it
+struct TelemetrySample {
+    std::uint64_t generation{0};
+    float computeMicros{0.0f};
+    /// Zero for generations the display never showed
+    float renderMicros{0.0f};
+    std::uint64_t population{0};
+    std::uint64_t births{0};
+    std::uint64_t deaths{0};
+};
+
+/// Fixed-size ring of the most recent samples: recording overwrites the oldest sample and never
+/// allocates, so it can run every generation
+/// \note Not synchronized; each ring belongs to the one thread that records into it
+class Telemetry {
+public:
+    explicit Telemetry(std::size_t capacity = TELEMETRY_CAPACITY);
+
+    const TelemetrySample& getLatest() const;
+    const TelemetrySample& getSample(std::size_t index) const;
+    std::size_t getSize() const;
+    bool isEmpty() const;
+    void mergeRenderTimes(const Telemetry& frames);
+    void record(const TelemetrySample& sample);
+    bool write(const std::string& filename) const;
+
+private:
+    bool writeCSV(std::ostream& out) const;
+    bool writeJSON(std::ostream& out) const;
+
+    std::vector<TelemetrySample> m_samples;
+    std::size_t m_next{0};
+    std::size_t m_size{0};
+};
+}  // namespace gol
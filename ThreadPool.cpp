@@ -0,0 +1,134 @@
+/// \file ThreadPool.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace gol {
+
+/// \note The calling thread works too, so a pool of N threads starts N - 1 workers
+ThreadPool::ThreadPool(int threadCount) {
+    const auto workerCount = std::max(resolveThreadCount(threadCount), 1) - 1;
+    m_workers.reserve(workerCount);
+    for (auto i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+///
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeWorkers.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+///
+int ThreadPool::getThreadCount() const {
+    return static_cast<int>(m_workers.size()) + 1;
+}
+
+/// \note Acts as the barrier between passes: nothing written by \p task in this pass is
+/// visible to the next pass until every task has completed
+void ThreadPool::run(int taskCount, const std::function<void(int)>& task) {
+    if (taskCount <= 0) {
+        return;
+    }
+
+    if (m_workers.empty() || taskCount == 1) {
+        for (auto i = 0; i < taskCount; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    // One pass at a time, should copies of a grid share the pool across threads
+    std::lock_guard runLock(m_runMutex);
+    {
+        std::lock_guard lock(m_mutex);
+        m_task = &task;
+        m_taskCount = taskCount;
+        m_nextTask = 0;
+        m_tasksDone = 0;
+        ++m_pass;
+    }
+    m_wakeWorkers.notify_all();
+
+    drainTasks();
+
+    std::unique_lock lock(m_mutex);
+    m_passDone.wait(lock, [this] { return m_tasksDone == m_taskCount; });
+    m_task = nullptr;
+}
+
+/// \note Zero or less asks for one thread per hardware thread
+int ThreadPool::resolveThreadCount(int requested) {
+    if (requested > 0) {
+        return requested;
+    }
+
+    return std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+}
+
+/// \note PRIVATE
+void ThreadPool::drainTasks() {
+    std::unique_lock lock(m_mutex);
+    while (m_task != nullptr && m_nextTask < m_taskCount) {
+        const auto taskIndex = m_nextTask++;
+        const auto* task = m_task;
+
+        lock.unlock();
+        (*task)(taskIndex);
+        lock.lock();
+
+        if (++m_tasksDone == m_taskCount) {
+            m_passDone.notify_one();
+        }
+    }
+}
+
+/// \note PRIVATE
+void ThreadPool::workerLoop() {
+    std::uint64_t lastPass = 0;
+    while (true) {
+        {
+            std::unique_lock lock(m_mutex);
+            m_wakeWorkers.wait(lock, [this, lastPass] { return m_stopping || m_pass != lastPass; });
+            if (m_stopping) {
+                return;
+            }
+            lastPass = m_pass;
+        }
+
+        drainTasks();
+    }
+}
+}  // namespace gol
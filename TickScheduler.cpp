@@ -0,0 +1,65 @@
+/// \file TickScheduler.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "TickScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
+
+namespace gol {
+
+///
+TickScheduler::TickScheduler(float periodSecs, Now now)
+    : m_now(std::move(now))
+    , m_period(std::chrono::duration_cast<Clock::duration>(
+              std::chrono::duration<float>(std::max(periodSecs, 0.0f))))
+    , m_deadline(m_now()) {}
+
+/// Moves on to the next deadline and returns it
+/// \note A loop that falls behind shifts its schedule rather than bursting to catch up
+TickScheduler::Clock::time_point TickScheduler::advance() {
+    m_deadline = std::max(m_deadline + m_period, m_now());
+    return m_deadline;
+}
+
+///
+TickScheduler::Clock::duration TickScheduler::getPeriod() const {
+    return m_period;
+}
+
+///
+bool TickScheduler::isMaxSpeed() const {
+    return m_period == Clock::duration::zero();
+}
+
+/// \note Restarts the schedule from now, as after a pause
+void TickScheduler::restart() {
+    m_deadline = m_now();
+}
+
+/// \note Sleeps rather than spins, so a loop paced this way costs next to no CPU while idle
+void TickScheduler::sleepUntilNext() {
+    std::this_thread::sleep_until(advance());
+}
+}  // namespace gol
@@ -0,0 +1,51 @@
+/// \file TickScheduler.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include <chrono>
+#include <functional>
+
+namespace gol {
+
+/// Paces a loop to a fixed period against absolute deadlines: each deadline is the previous one
+/// plus the period, so time spent working or oversleeping never accumulates as drift
+/// \note A period of zero or less is max speed, where every deadline has already passed
+class TickScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    /// Where the current time comes from; the steady clock unless a test steps time itself
+    using Now = std::function<Clock::time_point()>;
+
+    explicit TickScheduler(float periodSecs, Now now = Clock::now);
+
+    Clock::time_point advance();
+    Clock::duration getPeriod() const;
+    bool isMaxSpeed() const;
+    void restart();
+    void sleepUntilNext();
+
+private:
+    Now m_now;
+    Clock::duration m_period;
+    Clock::time_point m_deadline;
+};
+}  // namespace gol
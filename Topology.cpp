@@ -0,0 +1,60 @@
+/// \file Topology.cpp
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "Topology.h"
+
+#include <algorithm>
+#include <cctype>
+#include <optional>
+#include <string>
+
+namespace gol {
+
+///
+std::optional<Topology> parseTopology(const std::string& name) {
+    std::string lowered(name);
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+
+    for (auto topology :
+         {Topology::BOUNDED, Topology::TORUS, Topology::KLEIN_BOTTLE, Topology::CROSS_SURFACE}) {
+        if (lowered == topologyName(topology)) {
+            return topology;
+        }
+    }
+
+    return std::nullopt;
+}
+
+///
+std::string topologyName(Topology topology) {
+    switch (topology) {
+    case Topology::TORUS:
+        return "torus";
+    case Topology::KLEIN_BOTTLE:
+        return "klein";
+    case Topology::CROSS_SURFACE:
+        return "cross";
+    default:
+        return "bounded";
+    }
+}
+}  // namespace gol
@@ -0,0 +1,63 @@
+/// \file Topology.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include <optional>
+#include <string>
+
+namespace gol {
+/// How the edges of a finite grid join up
+/// \note The torus joins opposite edges straight across; the Klein bottle joins its left and
+/// right edges straight and its top and bottom edges with a twist, so column c of the top row
+/// meets column width - 1 - c of the bottom row; the cross-surface twists both pairs
+/// \see https://conwaylife.com/wiki/Bounded_grids
+enum class Topology { BOUNDED, TORUS, KLEIN_BOTTLE, CROSS_SURFACE };
+
+std::optional<Topology> parseTopology(const std::string& name);
+std::string topologyName(Topology topology);
+
+/// Maps (col, row), at most one cell beyond an edge of the grid, onto the cell it stands for;
+/// false if it stands for no cell at all
+/// \note A bounded grid has nothing beyond its edges. Rows are joined before columns, so the
+/// corners of a twisted grid follow from its edges.
+template<Topology T>
+inline bool mapOntoGrid(int& col, int& row, int width, int height) {
+    if constexpr (T == Topology::BOUNDED) {
+        return col >= 0 && col < width && row >= 0 && row < height;
+    } else {
+        if (row < 0 || row >= height) {
+            row = (row + height) % height;
+            if constexpr (T != Topology::TORUS) {
+                col = width - 1 - col;
+            }
+        }
+        if (col < 0 || col >= width) {
+            col = (col + width) % width;
+            if constexpr (T == Topology::CROSS_SURFACE) {
+                row = height - 1 - row;
+            }
+        }
+
+        return true;
+    }
+}
+}  // namespace gol
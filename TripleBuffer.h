@@ -0,0 +1,83 @@
+/// \file TripleBuffer.h
+/// \author Norm Evangelista
+/// \copyright (c) 2025 Norm Evangelista
+// Copyright 2025 gnawme (Norm Evangelista)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace gol {
+
+/// Lock-free single producer, single consumer handoff of the latest value: the producer
+/// fills back() and publishes it, the consumer acquires whatever was published last. Neither
+/// side ever waits; values published faster than they are acquired are simply replaced
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    explicit TripleBuffer(const T& initial)
+        : m_slots{initial, initial, initial} {}
+
+    /// \note Producer only
+    T& back() {
+        return m_slots[m_back];
+    }
+
+    /// \note Consumer only
+    const T& front() const {
+        return m_slots[m_front];
+    }
+
+    /// Swaps the back slot into the middle, marking it fresh
+    /// \note Producer only
+    void publish() {
+        auto previous = m_middle.exchange(m_back | FRESH, std::memory_order_acq_rel);
+        m_back = previous & INDEX_MASK;
+    }
+
+    /// Takes the middle slot as the new front if something was published since the last call
+    /// \note Consumer only
+    bool acquire() {
+        if ((m_middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+            return false;
+        }
+
+        auto previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & INDEX_MASK;
+        return true;
+    }
+
+    /// Whether a published value is still waiting for the consumer
+    bool isFresh() const {
+        return (m_middle.load(std::memory_order_acquire) & FRESH) != 0;
+    }
+
+private:
+    static constexpr std::uint8_t INDEX_MASK{0x3};
+    static constexpr std::uint8_t FRESH{0x4};
+
+    std::array<T, 3> m_slots{};
+    std::uint8_t m_back{0};
+    std::atomic<std::uint8_t> m_middle{1};
+    std::uint8_t m_front{2};
+};
+}  // namespace gol
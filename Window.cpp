@@ -32,6 +32,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace gol {
@@ -133,6 +134,16 @@ bool Window::isFullscreen() const {
     return m_isFullscreen;
 }
 
+/// \note Toggled with F3
+bool Window::isOverlayShown() const {
+    return m_isOverlayShown;
+}
+
+/// \note Requested with F2; true once per press
+bool Window::takeSnapshotRequest() {
+    return std::exchange(m_isSnapshotRequested, false);
+}
+
 ///
 void Window::draw(sf::Drawable& drawable) {
     m_window.draw(drawable);
@@ -150,18 +161,26 @@ void Window::toggleFullScreen() {
     create();
 }
 
-///
-void Window::update() {
+/// \note Returns whether any event arrived, since the window may then need redrawing
+bool Window::update() {
+    bool handled = false;
     while (const std::optional event = m_window.pollEvent()) {
+        handled = true;
         if (event->is<sf::Event::Closed>()) {
             m_isDone = true;
         } else if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
-            if (keyPressed->code == sf::Keyboard::Key::F5) {
+            if (keyPressed->code == sf::Keyboard::Key::F2) {
+                m_isSnapshotRequested = true;
+            } else if (keyPressed->code == sf::Keyboard::Key::F3) {
+                m_isOverlayShown = !m_isOverlayShown;
+            } else if (keyPressed->code == sf::Keyboard::Key::F5) {
                 toggleFullScreen();
             } else if (keyPressed->code == sf::Keyboard::Key::Escape) {
                 m_isDone = true;
             }
         }
     }
+
+    return handled;
 }
 }  // namespace gol
\ No newline at end of file
@@ -28,6 +28,9 @@
 #include <string>
 
 namespace gol {
+/// Frames per second the window is drawn at, at most
+constexpr unsigned int DISPLAY_RATE_HZ{60};
+
 class Window {
 public:
     Window();
@@ -37,10 +40,12 @@ public:
     void beginDraw();
     void endDraw();
 
-    void update();
+    bool update();
 
     bool isDone() const;
     bool isFullscreen() const;
+    bool isOverlayShown() const;
+    bool takeSnapshotRequest();
     sf::Vector2u getWindowSize();
 
     void toggleFullScreen();
@@ -56,5 +61,7 @@ private:
     sf::String m_windowTitle{"Window"};
     bool m_isDone{false};
     bool m_isFullscreen{false};
+    bool m_isOverlayShown{false};
+    bool m_isSnapshotRequested{false};
 };
 }  // namespace gol
\ No newline at end of file
@@ -15,6 +15,7 @@ class GameOfLifeConan(ConanFile):
 
     def build_requirements(self):
         self.test_requires("gtest/1.15.0")
+        self.test_requires("benchmark/1.9.1")
 
     # Generators
     generators = "CMakeDeps", "CMakeToolchain"
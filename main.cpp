@@ -20,14 +20,26 @@
 // LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
+#include "Census.h"
+#include "Checkpoint.h"
 #include "ConwayDefs.h"
 #include "ConwayGrid.h"
 #include "GOLConfig.h"
 #include "GOLFile.h"
+#include "HashLife.h"
+#include "Headless.h"
+#include "LifeKernel.h"
+#include "Rule.h"
+#include "Soup.h"
+#include "Telemetry.h"
+#include "TickScheduler.h"
+#include "Topology.h"
+
+// The gol_headless target defines GOL_HEADLESS and links without SFML
+#ifndef GOL_HEADLESS
 #include "GameOfLife.h"
 #include "SFML/System/Clock.hpp"
-#include "SFML/System/Sleep.hpp"
-#include "SFML/System/Time.hpp"
+#endif
 
 #include <cxxopts.hpp>
 
@@ -46,29 +58,75 @@
 using namespace gol;
 
 namespace {
+/// Generations a headless run steps unless told otherwise
+constexpr std::uint64_t HEADLESS_GENERATIONS{1000};
+
 ///
-std::optional<float>
-fitPatternToScreenSize(const PatternArray& patternArray, GOLConfig& golConfig) {
-    if (patternArray.empty() || patternArray[0].empty()) {
-        std::cerr << "Error: Empty pattern array in fitPatternToScreenSize" << std::endl;
+void logAdvance(const HashLife& hashLife) {
+    std::clog << "Advanced pattern to generation " << hashLife.getGeneration()
+              << " with HashLife, " << hashLife.getPopulation() << " live cells, "
+              << hashLife.getNodeCount() << " nodes" << std::endl;
+}
+
+/// \note Jumps ahead with HashLife, then crops the plane back to the pattern's own bounds
+std::optional<BitGrid> advancePattern(
+        const BitGrid& cells,
+        std::uint64_t advance,
+        const Rule& rule,
+        GOLConfig& golConfig) {
+    HashLife hashLife(cells, golConfig.getHashLifeMemory());
+    hashLife.setRule(rule);
+    if (!hashLife.step(advance)) {
+        return std::nullopt;
+    }
+    logAdvance(hashLife);
+
+    return hashLife.getBitGrid(PlaneRect{0, 0, cells.getWidth(), cells.getHeight()});
+}
+
+/// Jumps a Macrocell pattern ahead in the quadtree it is read into, then crops the plane to the
+/// live cells the file held
+/// \note The pattern is never expanded into a grid until it has been advanced, so a plane far
+/// larger than any grid can still be jumped to a generation worth showing
+std::optional<BitGrid> advanceMacrocell(
+        GOLFile& patternFile,
+        std::uint64_t advance,
+        const std::optional<Rule>& ruleOverride,
+        GOLConfig& golConfig) {
+    HashLife hashLife(golConfig.getHashLifeMemory());
+    if (!patternFile.readMacrocell(hashLife)) {
         return std::nullopt;
     }
 
-    auto numCols = patternArray[0].length();
-    auto numRows = patternArray.size();
+    auto window = hashLife.getBounds().value_or(PlaneRect{0, 0, 1, 1});
+    hashLife.setRule(ruleOverride.value_or(patternFile.getRule().value_or(Rule())));
+    if (!hashLife.step(advance)) {
+        return std::nullopt;
+    }
+    logAdvance(hashLife);
+
+    return cropToBitGrid(hashLife, window);
+}
+
+/// \note Patterns larger than the screen get tiles smaller than a pixel, which only the
+/// texture renderer can draw
+std::optional<float> fitPatternToScreenSize(int width, int height, GOLConfig& golConfig) {
+    if (width == 0 || height == 0) {
+        std::cerr << "Error: Empty pattern in fitPatternToScreenSize" << std::endl;
+        return std::nullopt;
+    }
+
+    auto numCols = static_cast<float>(width);
+    auto numRows = static_cast<float>(height);
 
     auto tileSize = golConfig.getTileSize();
     auto maxCols = numCols * tileSize;
-    auto maxRows = patternArray.size() * tileSize;
+    auto maxRows = numRows * tileSize;
 
     ScreenSize screenSize = golConfig.getScreenSize();
 
     while (maxCols > screenSize.first || maxRows > screenSize.second) {
         tileSize /= 2;
-        if (tileSize == 1) {
-            return std::nullopt;
-        }
-
         maxCols = numCols * tileSize;
         maxRows = numRows * tileSize;
     }
@@ -76,9 +134,15 @@ fitPatternToScreenSize(const PatternArray& patternArray, GOLConfig& golConfig) {
     return tileSize;
 }
 
-///
-std::optional<std::pair<ConwayGrid, float>>
-generateGridFromPatternFile(std::string& patternName, GOLConfig& golConfig, bool wrappedGrid) {
+/// \note The rule comes from \p ruleOverride if given, else from an RLE or Macrocell
+/// header, else B3/S23
+std::optional<std::pair<ConwayGrid, float>> generateGridFromPatternFile(
+        std::string& patternName,
+        GOLConfig& golConfig,
+        Topology topology,
+        KernelType kernel,
+        std::uint64_t advance,
+        const std::optional<Rule>& ruleOverride) {
     namespace fs = std::filesystem;
 
     // Check if file exists before attempting to open
@@ -99,18 +163,29 @@ generateGridFromPatternFile(std::string& patternName, GOLConfig& golConfig, bool
     fs::path patternPath(patternName);
     patternName = patternPath.filename().string();
 
-    PatternArray patternArray = patternFile.getPatternArray();
-    if (patternArray.empty()) {
+    // A Macrocell pattern is advanced before it is ever expanded into a grid
+    const auto advanceFirst = advance > 0 && patternFile.isMacrocell();
+    auto cells = advanceFirst ? advanceMacrocell(patternFile, advance, ruleOverride, golConfig)
+                              : patternFile.getBitGrid();
+    if (!cells.has_value()) {
         std::cerr << "Couldn't read pattern file " << patternFile.getFilename() << std::endl;
         return std::nullopt;
     }
 
-    std::clog << "Read Conway grid of " << patternArray.size() << " rows, "
-              << patternArray[0].length() << " cols" << std::endl;
-    auto tileSize = fitPatternToScreenSize(patternArray, golConfig);
+    std::clog << "Read Conway grid of " << cells->getHeight() << " rows, " << cells->getWidth()
+              << " cols" << std::endl;
+
+    auto rule = ruleOverride.value_or(patternFile.getRule().value_or(Rule()));
+    if (advance > 0 && !advanceFirst) {
+        cells = advancePattern(cells.value(), advance, rule, golConfig);
+        if (!cells.has_value()) {
+            std::cerr << "Couldn't advance " << patternFile.getFilename() << " by " << advance
+                      << " generations" << std::endl;
+            return std::nullopt;
+        }
+    }
+    auto tileSize = fitPatternToScreenSize(cells->getWidth(), cells->getHeight(), golConfig);
     if (!tileSize.has_value()) {
-        std::cerr << patternFile.getFilename() << " is larger than currently supported"
-                  << std::endl;
         return std::nullopt;
     }
 
@@ -119,14 +194,60 @@ generateGridFromPatternFile(std::string& patternName, GOLConfig& golConfig, bool
             static_cast<unsigned int>(screenSize.first / tileSize.value()),
             static_cast<unsigned int>(screenSize.second / tileSize.value())};
 
-    return std::make_pair(ConwayGrid(patternArray, tiling, wrappedGrid), tileSize.value());
+    ConwayGrid conwayGrid(cells.value(), tiling, topology, kernel);
+    conwayGrid.setRule(rule);
+
+    return std::make_pair(std::move(conwayGrid), tileSize.value());
 }
 
-///
-std::optional<std::pair<ConwayGrid, float>>
-generateRandomSoup(GOLConfig& golConfig, bool wrappedGrid) {
-    return std::make_pair(
-            ConwayGrid(golConfig.getScreenTiling(), wrappedGrid), golConfig.getTileSize());
+/// Carries on from a checkpoint, at its generation, topology and rule unless \p ruleOverride
+/// is given
+std::optional<std::pair<ConwayGrid, float>> generateGridFromCheckpoint(
+        std::string& checkpointName,
+        GOLConfig& golConfig,
+        KernelType kernel,
+        const std::optional<Rule>& ruleOverride) {
+    auto checkpoint = readCheckpoint(checkpointName);
+    if (!checkpoint.has_value()) {
+        return std::nullopt;
+    }
+
+    // Later checkpoints go back to the same file
+    checkpointName = std::filesystem::path(checkpointName).filename().string();
+
+    auto tileSize = fitPatternToScreenSize(checkpoint->width, checkpoint->height, golConfig);
+    if (!tileSize.has_value()) {
+        return std::nullopt;
+    }
+
+    ConwayGrid conwayGrid(checkpoint.value(), kernel);
+    if (ruleOverride.has_value()) {
+        conwayGrid.setRule(ruleOverride.value());
+    }
+
+    return std::make_pair(std::move(conwayGrid), tileSize.value());
+}
+
+/// \note The seed is logged, so that --seed can draw the same soup again
+std::optional<std::pair<ConwayGrid, float>> generateRandomSoup(
+        GOLConfig& golConfig,
+        const SoupConfig& soup,
+        Topology topology,
+        KernelType kernel,
+        const std::optional<Rule>& ruleOverride) {
+    const auto screenTiling = golConfig.getScreenTiling();
+    std::clog << "Drawing a " << soupSymmetryName(soup.symmetry) << " soup at density "
+              << soup.density << " from seed " << soup.seed << std::endl;
+    ConwayGrid conwayGrid(
+            makeSoup(static_cast<int>(screenTiling.first),
+                    static_cast<int>(screenTiling.second),
+                    soup),
+            screenTiling,
+            topology,
+            kernel);
+    conwayGrid.setRule(ruleOverride.value_or(Rule()));
+
+    return std::make_pair(std::move(conwayGrid), golConfig.getTileSize());
 }
 
 ///
@@ -136,6 +257,78 @@ std::uint64_t getTimestamp() {
             .count();
 }
 
+#ifndef GOL_HEADLESS
+/// Shapes and vertices leave a pixel between cells, so smaller tiles would vanish
+constexpr float MIN_SHAPE_TILE_SIZE{2.0f};
+
+/// \note Displays generations as the simulation thread steps them, until the window closes
+int runWindowed(
+        std::string& patternName,
+        ConwayGrid conwayGrid,
+        float tileSize,
+        GOLConfig& golConfig,
+        const std::string& rendererOption,
+        bool classicMode,
+        float tickSecs,
+        int generationsPerTick,
+        std::uint64_t dumpEvery,
+        std::uint64_t checkpointEvery,
+        const std::string& telemetryFile) {
+    auto renderer = parseRendererType(rendererOption);
+    if (!renderer.has_value()) {
+        std::cerr << "Error: Unknown renderer " << rendererOption << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    golConfig.setClassicMode(classicMode);
+
+    if (tileSize < MIN_SHAPE_TILE_SIZE && renderer != RendererType::TEXTURE) {
+        std::clog << "Tiles of " << tileSize << " pixels are too small for the "
+                  << rendererName(renderer.value()) << " renderer, using texture" << std::endl;
+        renderer = RendererType::TEXTURE;
+    }
+    golConfig.setTileSize(tileSize);
+    GameOfLife game(
+            patternName,
+            std::move(conwayGrid),
+            golConfig.getScreenSize(),
+            tileSize,
+            golConfig,
+            renderer.value());
+
+    auto* gameWindow = game.getWindow();
+    game.render();
+
+    TickScheduler display(1.0f / DISPLAY_RATE_HZ);
+    sf::Clock startupClock;
+    float startupDelay = golConfig.getStartupDelay();
+    while (startupClock.getElapsedTime().asSeconds() < startupDelay && !gameWindow->isDone()) {
+        game.handleInput();
+        game.render();
+        display.sleepUntilNext();
+    }
+
+    // Generations are stepped on their own thread; this loop only displays them, drawing
+    // only when something changed and sleeping until the next display deadline otherwise
+    game.startSimulation(tickSecs, generationsPerTick, dumpEvery, checkpointEvery);
+    display.restart();
+    while (!gameWindow->isDone()) {
+        game.handleInput();
+        if (game.update()) {
+            game.render();
+        }
+        display.sleepUntilNext();
+    }
+    game.stopSimulation();
+
+    if (!telemetryFile.empty()) {
+        game.writeTelemetry(telemetryFile);
+    }
+
+    return EXIT_SUCCESS;
+}
+#endif
+
 ///
 void printUsage() {
     std::cout << "\n";
@@ -143,21 +336,82 @@ void printUsage() {
     std::cout << "====================================================================\n\n";
     std::cout << "USAGE:\n";
     std::cout << "  game_of_life <pattern-file> [OPTIONS]\n";
-    std::cout << "  game_of_life --random [OPTIONS]\n\n";
+    std::cout << "  game_of_life --random [OPTIONS]\n";
+    std::cout << "  game_of_life --resume <checkpoint> [OPTIONS]\n";
+    std::cout << "  game_of_life --census <N> [OPTIONS]\n\n";
     std::cout << "DESCRIPTION:\n";
     std::cout << "  Simulates Conway's Game of Life with colorized cell transitions.\n";
-    std::cout << "  Supports plaintext (.cells) and RLE (.rle) pattern formats.\n\n";
+    std::cout << "  Supports plaintext (.cells), RLE (.rle) and Macrocell (.mc) pattern\n";
+    std::cout << "  formats.\n\n";
     std::cout << "ARGUMENTS:\n";
-    std::cout << "  <pattern-file>    Path to a pattern file (.cells or .rle format)\n";
+    std::cout << "  <pattern-file>    Path to a pattern file (.cells, .rle or .mc format)\n";
     std::cout << "                    Example: ./patterns/glider.cells\n\n";
     std::cout << "OPTIONS:\n";
     std::cout << "  --random          Generate a random soup instead of loading a pattern\n";
-    std::cout << "  --wrapped         Enable wrapped/toroidal grid (infinite plane)\n";
+    std::cout << "  --seed <N>        Seed of the random soup, or of the first census soup;\n";
+    std::cout << "                    the same seed draws the same soup. Default: a fresh\n";
+    std::cout << "                    seed, logged so the soup can be drawn again\n";
+    std::cout << "  --density <p>     Fraction of the soup's cells alive. Default: 0.5\n";
+    std::cout << "  --symmetry <sym>  Soup symmetry: C1 (none), C2 (half turn), C4 (quarter\n";
+    std::cout << "                    turn) or D8 (every rotation and reflection); C4 and D8\n";
+    std::cout << "                    soups fill the largest centered square. Default: C1\n";
+    std::cout << "  --wrapped         Enable wrapped/toroidal grid (infinite plane);\n";
+    std::cout << "                    short for --topology torus\n";
     std::cout << "                    Default: bounded grid with edges\n";
+    std::cout << "  --topology <name> How the grid's edges join: bounded, torus, klein (a Klein\n";
+    std::cout << "                    bottle, its top and bottom joined with a twist) or\n";
+    std::cout << "                    cross (a cross-surface, both pairs twisted)\n";
+    std::cout << "                    Default: bounded\n";
+    std::cout << "  --unbounded       Grow the plane without bound, the window becoming a\n";
+    std::cout << "                    viewport onto it\n";
     std::cout << "  --classic         Use classic display (white/black only)\n";
     std::cout << "                    Default: colorized transition display\n";
+    std::cout << "  --verbose         Log the generation and how many tiles are active about\n";
+    std::cout << "                    once a second while the window is open\n";
+    std::cout << "  --rule <rule>     Rule in B/S notation, such as B36/S23 (HighLife),\n";
+    std::cout << "                    B3678/S34678 (Day & Night) or B2/S (Seeds); S/B\n";
+    std::cout << "                    notation (23/36) also works. Default: the RLE or\n";
+    std::cout << "                    Macrocell file's rule, else B3/S23\n";
+    std::cout << "  --advance <N>     Jump the pattern N generations ahead with HashLife, up to\n";
+    std::cout << "                    2^58, before display (pattern files only)\n";
+    std::cout << "  --threads <N>     Threads stepping the grid in row bands; 0 uses every\n";
+    std::cout << "                    hardware thread. Default: threadCount in gol_config.json\n";
+    std::cout << "  --kernel <name>   Generation kernel: auto, scalar, sse2 or avx2\n";
+    std::cout << "                    Default: auto (widest kernel this CPU supports)\n";
+    std::cout << "  --renderer <name> Grid renderer: vertices (one batched draw), shapes\n";
+    std::cout << "                    (one draw per cell) or texture (one texel per cell).\n";
+    std::cout << "                    Default: vertices; texture when tiles are under 2px\n";
+    std::cout << "  --generations-per-tick <N>\n";
+    std::cout << "                    Generations stepped each life tick.\n";
+    std::cout << "                    Default: generationsPerTick in gol_config.json\n";
+    std::cout << "  --max-speed       Step generations back to back instead of once per life\n";
+    std::cout << "                    tick, showing the newest at the display rate\n";
+    std::cout << "  --headless        Step the grid without a window, as fast as possible, and\n";
+    std::cout << "                    report throughput and the final population\n";
+    std::cout << "                    (always on for gol_headless)\n";
+    std::cout << "  --generations <N> Generations a headless run steps. Default: 1000\n";
+    std::cout << "  --until-stable    End a headless run early once it dies out, stops changing\n";
+    std::cout << "                    or repeats itself, reporting when and with what period\n";
+    std::cout << "  --dump-every <N>  Write the grid to <pattern>_<generation>.rle every N\n";
+    std::cout << "                    generations\n";
+    std::cout << "  --checkpoint-every <N>\n";
+    std::cout << "                    Checkpoint the run to <pattern>.ckpt every N\n";
+    std::cout << "                    generations and on exit, on a background thread\n";
+    std::cout << "  --resume <file>   Carry on from a checkpoint, at its generation and under\n";
+    std::cout << "                    its topology and rule (--rule still overrides it)\n";
+    std::cout << "  --census <N>      Run N seeded 16x16 soups on the unbounded plane until each\n";
+    std::cout << "                    settles, on --threads threads, and count the still lifes,\n";
+    std::cout << "                    oscillators and spaceships they leave\n";
+    std::cout << "  --telemetry <file>\n";
+    std::cout << "                    Write compute and render time, population, births and\n";
+    std::cout << "                    deaths of the last 4096 generations to a .csv or .json\n";
+    std::cout << "                    file on exit\n";
     std::cout << "  -h, --help        Display this help message and exit\n\n";
     std::cout << "INTERACTIVE CONTROLS:\n";
+    std::cout << "  F2                Write the grid to <pattern>_<generation>.rle\n";
+    std::cout << "  F3                Toggle the telemetry overlay: compute (green) and render\n";
+    std::cout << "                    (orange) time per frame against one frame's budget, and\n";
+    std::cout << "                    the population (cyan)\n";
     std::cout << "  F5                Toggle fullscreen mode\n";
     std::cout << "  ESC               Exit the simulation\n\n";
     std::cout << "CONFIGURATION:\n";
@@ -168,13 +422,36 @@ void printUsage() {
     std::cout << "  game_of_life patterns/glider.cells\n\n";
     std::cout << "  # Run with wrapped grid (infinite plane)\n";
     std::cout << "  game_of_life patterns/gosper_glider_gun.rle --wrapped\n\n";
+    std::cout << "  # Let a glider gun's gliders fly off the window rather than wrap\n";
+    std::cout << "  game_of_life patterns/gosperglidergun.rle --unbounded\n\n";
     std::cout << "  # Generate a random soup\n";
     std::cout << "  game_of_life --random\n\n";
+    std::cout << "  # Draw the same sparse, symmetric soup again\n";
+    std::cout << "  game_of_life --random --seed 42 --density 0.3 --symmetry D8\n\n";
     std::cout << "  # Random soup with wrapped grid\n";
     std::cout << "  game_of_life --random --wrapped\n\n";
+    std::cout << "  # Watch gliders come back mirrored on a Klein bottle\n";
+    std::cout << "  game_of_life --random --topology klein\n\n";
+    std::cout << "  # Show a glider gun a billion generations in\n";
+    std::cout << "  game_of_life patterns/gosperglidergun.rle --advance 1000000000\n\n";
+    std::cout << "  # Checkpoint a long headless run, then carry on where it stopped\n";
+    std::cout << "  gol_headless --random --generations 1000000 --checkpoint-every 10000\n";
+    std::cout << "  gol_headless --resume soup_<timestamp>.ckpt --generations 1000000\n\n";
+    std::cout << "  # Count what a hundred thousand soups settle into, on every core\n";
+    std::cout << "  gol_headless --census 100000 --threads 0\n\n";
+    std::cout << "  # Run a soup under HighLife\n";
+    std::cout << "  game_of_life --random --rule B36/S23\n\n";
+    std::cout << "  # Compare generation kernels on the same machine\n";
+    std::cout << "  game_of_life --random --kernel scalar\n";
+    std::cout << "  game_of_life --random --kernel avx2\n\n";
+    std::cout << "  # Measure throughput on a machine with no display\n";
+    std::cout << "  gol_headless --random --generations 10000 --threads 0\n\n";
+    std::cout << "  # Watch a soup evolve as fast as this machine can step it\n";
+    std::cout << "  game_of_life --random --max-speed --threads 0\n\n";
     std::cout << "PATTERN FORMATS:\n";
     std::cout << "  Plaintext (.cells): https://conwaylife.com/wiki/Plaintext\n";
-    std::cout << "  RLE (.rle):         https://conwaylife.com/wiki/Run_Length_Encoded\n\n";
+    std::cout << "  RLE (.rle):         https://conwaylife.com/wiki/Run_Length_Encoded\n";
+    std::cout << "  Macrocell (.mc):    https://conwaylife.com/wiki/Macrocell\n\n";
 }
 }  // namespace
 
@@ -187,10 +464,74 @@ int main(int argc, char** argv) {
                 "wrapped",
                 "Set grid to wrap at its edges (infinite plane)",
                 cxxopts::value<bool>()->default_value("false"))(
+                "topology",
+                "How the grid's edges join (bounded, torus, klein, cross)",
+                cxxopts::value<std::string>()->default_value("bounded"))(
+                "unbounded",
+                "Grow the plane without bound, viewed through the window",
+                cxxopts::value<bool>()->default_value("false"))(
                 "classic",
                 "Use classic color display (live/dead only)",
                 cxxopts::value<bool>()->default_value("false"))(
+                "verbose",
+                "Log how many tiles are active about once a second",
+                cxxopts::value<bool>()->default_value("false"))(
                 "random", "Create a random soup", cxxopts::value<bool>()->default_value("false"))(
+                "seed",
+                "Seed of a random soup, or of a census's first soup",
+                cxxopts::value<std::uint64_t>())(
+                "density",
+                "Fraction of a random soup's cells alive",
+                cxxopts::value<double>()->default_value(std::to_string(SOUP_DENSITY)))(
+                "symmetry",
+                "Symmetry of a random soup (C1, C2, C4, D8)",
+                cxxopts::value<std::string>()->default_value("C1"))(
+                "kernel",
+                "Generation kernel (auto, scalar, sse2, avx2)",
+                cxxopts::value<std::string>()->default_value("auto"))(
+                "rule",
+                "Rule in B/S notation, overriding a pattern file's own (e.g. B36/S23)",
+                cxxopts::value<std::string>())(
+                "advance",
+                "Generations to jump ahead with HashLife before display",
+                cxxopts::value<std::uint64_t>()->default_value("0"))(
+                "threads",
+                "Threads stepping the grid (0 for every hardware thread)",
+                cxxopts::value<int>())(
+                "renderer",
+                "Grid renderer (vertices, shapes, texture)",
+                cxxopts::value<std::string>()->default_value("vertices"))(
+                "generations-per-tick",
+                "Generations stepped each life tick",
+                cxxopts::value<int>())(
+                "max-speed",
+                "Step generations back to back, ignoring the life tick",
+                cxxopts::value<bool>()->default_value("false"))(
+                "headless",
+                "Step the grid without a window and report throughput",
+                cxxopts::value<bool>()->default_value("false"))(
+                "generations",
+                "Generations a headless run steps",
+                cxxopts::value<std::uint64_t>()->default_value(
+                        std::to_string(HEADLESS_GENERATIONS)))(
+                "until-stable",
+                "End a headless run once it dies out, stops changing or cycles",
+                cxxopts::value<bool>()->default_value("false"))(
+                "dump-every",
+                "Write the grid to an RLE file every N generations",
+                cxxopts::value<std::uint64_t>()->default_value("0"))(
+                "checkpoint-every",
+                "Checkpoint the run every N generations and on exit",
+                cxxopts::value<std::uint64_t>()->default_value("0"))(
+                "resume",
+                "Checkpoint to carry on from",
+                cxxopts::value<std::string>())(
+                "census",
+                "Run N seeded soups until they settle and count the objects left",
+                cxxopts::value<std::uint64_t>())(
+                "telemetry",
+                "Write per-generation telemetry to a .csv or .json file on exit",
+                cxxopts::value<std::string>()->default_value(""))(
                 "pattern", "Pattern file to load", cxxopts::value<std::string>())(
                 "positional", "Positional arguments", cxxopts::value<std::vector<std::string>>());
 
@@ -205,15 +546,99 @@ int main(int argc, char** argv) {
             return (argc == 1) ? EXIT_FAILURE : EXIT_SUCCESS;
         }
 
-        bool wrappedGrid = result["wrapped"].as<bool>();
-        std::clog << "Setting " << (wrappedGrid ? "infinite" : "bounded") << " grid" << std::endl;
+        auto topology = parseTopology(result["topology"].as<std::string>());
+        if (!topology.has_value()) {
+            std::cerr << "Error: Unknown topology " << result["topology"].as<std::string>()
+                      << "\n" << std::endl;
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        if (result["wrapped"].as<bool>()) {
+            if (topology != Topology::BOUNDED && topology != Topology::TORUS) {
+                std::cerr << "Error: --wrapped is a torus, not a "
+                          << topologyName(topology.value()) << "\n"
+                          << std::endl;
+                printUsage();
+                return EXIT_FAILURE;
+            }
+            topology = Topology::TORUS;
+        }
+
+        bool unboundedGrid = result["unbounded"].as<bool>();
+        if (topology != Topology::BOUNDED && unboundedGrid) {
+            std::cerr << "Error: --unbounded has no edges to join, so takes no topology\n"
+                      << std::endl;
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        std::clog << "Setting " << (unboundedGrid ? "unbounded" : topologyName(topology.value()))
+                  << " grid" << std::endl;
+
+        auto kernel = parseKernelType(result["kernel"].as<std::string>());
+        if (!kernel.has_value()) {
+            std::cerr << "Error: Unknown kernel " << result["kernel"].as<std::string>() << "\n"
+                      << std::endl;
+            printUsage();
+            return EXIT_FAILURE;
+        }
+
+        std::optional<Rule> rule;
+        if (result.count("rule")) {
+            rule = Rule::parse(result["rule"].as<std::string>());
+            if (!rule.has_value()) {
+                std::cerr << "Error: Unsupported rule " << result["rule"].as<std::string>()
+                          << "\n" << std::endl;
+                printUsage();
+                return EXIT_FAILURE;
+            }
+        }
+
+        auto symmetry = parseSoupSymmetry(result["symmetry"].as<std::string>());
+        if (!symmetry.has_value()) {
+            std::cerr << "Error: Unknown soup symmetry " << result["symmetry"].as<std::string>()
+                      << "\n" << std::endl;
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        SoupConfig soup;
+        soup.seed = result.count("seed") ? result["seed"].as<std::uint64_t>() : randomSeed();
+        soup.density = result["density"].as<double>();
+        soup.symmetry = symmetry.value();
+        if (!(soup.density >= 0.0 && soup.density <= 1.0)) {
+            std::cerr << "Error: Soup density " << soup.density << " is not between 0 and 1\n"
+                      << std::endl;
+            printUsage();
+            return EXIT_FAILURE;
+        }
+
+        if (result["advance"].as<std::uint64_t>() > HASHLIFE_MAX_GENERATIONS) {
+            std::cerr << "Error: --advance jumps at most " << HASHLIFE_MAX_GENERATIONS
+                      << " generations\n" << std::endl;
+            printUsage();
+            return EXIT_FAILURE;
+        }
 
-        bool classicMode = result["classic"].as<bool>();
+        if (result.count("census")) {
+            CensusConfig census;
+            census.soups = result["census"].as<std::uint64_t>();
+            census.firstSeed = soup.seed;
+            census.density = soup.density;
+            census.symmetry = soup.symmetry;
+            census.threadCount = result.count("threads") ? result["threads"].as<int>() : 0;
+            census.rule = rule.value_or(Rule());
+            std::clog << "Running a census of " << census.soups << " soups under "
+                      << census.rule.getName() << std::endl;
+            printCensusReport(runCensus(census), std::cout);
+            return EXIT_SUCCESS;
+        }
 
         bool randomSoup = result["random"].as<bool>();
+        bool resume = result.count("resume") != 0;
         std::string patternName;
 
-        if (randomSoup) {
+        if (resume) {
+            patternName = result["resume"].as<std::string>();
+        } else if (randomSoup) {
             std::clog << "Random soup requested" << std::endl;
             std::stringstream ss;
             ss << "soup_" << getTimestamp();
@@ -231,43 +656,77 @@ int main(int argc, char** argv) {
         }
 
         GOLConfig golConfig;
-        auto gridTiling = !randomSoup
-                ? generateGridFromPatternFile(patternName, golConfig, wrappedGrid)
-                : generateRandomSoup(golConfig, wrappedGrid);
+        std::optional<std::pair<ConwayGrid, float>> gridTiling;
+        if (resume) {
+            gridTiling = generateGridFromCheckpoint(patternName, golConfig, kernel.value(), rule);
+        } else if (randomSoup) {
+            gridTiling = generateRandomSoup(
+                    golConfig,
+                    soup,
+                    topology.value(),
+                    kernel.value(),
+                    rule);
+        } else {
+            gridTiling = generateGridFromPatternFile(
+                    patternName,
+                    golConfig,
+                    topology.value(),
+                    kernel.value(),
+                    result["advance"].as<std::uint64_t>(),
+                    rule);
+        }
 
         if (!gridTiling.has_value()) {
             std::cerr << "Failed to initialize game grid" << std::endl;
             return EXIT_FAILURE;
         }
 
-        golConfig.setClassicMode(classicMode);
-
         auto& [conwayGrid, tileSize] = gridTiling.value();
-        golConfig.setTileSize(tileSize);
-        GameOfLife game(patternName, conwayGrid, golConfig.getScreenSize(), tileSize, golConfig);
-
-        auto* gameWindow = game.getWindow();
-        game.render();
-
-        sf::Clock startupClock;
-        float startupDelay = golConfig.getStartupDelay();
-        while (startupClock.getElapsedTime().asSeconds() < startupDelay && !gameWindow->isDone()) {
-            game.handleInput();
-            game.render();
-
-            constexpr std::int32_t SPINNER_MS{16};
-            sf::sleep(sf::milliseconds(SPINNER_MS));
+        if (unboundedGrid) {
+            conwayGrid.makeUnbounded();
         }
+        conwayGrid.setThreadCount(
+                result.count("threads") ? result["threads"].as<int>() : golConfig.getThreadCount());
+
+#ifndef GOL_HEADLESS
+        if (!result["headless"].as<bool>()) {
+            golConfig.setVerbose(result["verbose"].as<bool>());
+            return runWindowed(
+                    patternName,
+                    std::move(conwayGrid),
+                    tileSize,
+                    golConfig,
+                    result["renderer"].as<std::string>(),
+                    result["classic"].as<bool>(),
+                    result["max-speed"].as<bool>() ? 0.0f : golConfig.getLifeTick(),
+                    result.count("generations-per-tick")
+                            ? result["generations-per-tick"].as<int>()
+                            : golConfig.getGenerationsPerTick(),
+                    result["dump-every"].as<std::uint64_t>(),
+                    result["checkpoint-every"].as<std::uint64_t>(),
+                    result["telemetry"].as<std::string>());
+        }
+#endif
 
-        while (!gameWindow->isDone()) {
-            game.handleInput();
-
-            sf::Time lifeTick{sf::seconds(golConfig.getLifeTick())};
-            if (game.getElapsed() >= lifeTick) {
-                game.update();
-                game.render();
-                game.restartClock();
-            }
+        auto generations = result["generations"].as<std::uint64_t>();
+        std::clog << "Running " << patternName << " headless for up to " << generations
+                  << " generations on " << conwayGrid.getThreadCount() << " threads"
+                  << std::endl;
+        auto telemetryFile = result["telemetry"].as<std::string>();
+        Telemetry telemetry;
+        const auto stem = std::filesystem::path(patternName).stem().string();
+        auto report = runHeadless(
+                conwayGrid,
+                generations,
+                result["until-stable"].as<bool>(),
+                telemetryFile.empty() ? nullptr : &telemetry,
+                result["dump-every"].as<std::uint64_t>(),
+                stem,
+                result["checkpoint-every"].as<std::uint64_t>(),
+                stem + "." + CHECKPOINT);
+        printHeadlessReport(report, std::cout);
+        if (!telemetryFile.empty()) {
+            telemetry.write(telemetryFile);
         }
 
         return EXIT_SUCCESS;